@@ -0,0 +1,159 @@
+#ifndef BENCHMARK_HXX
+#define BENCHMARK_HXX
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define BENCH_RDTSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define BENCH_RDTSC 0
+#endif
+
+/* Minimal timing helpers shared by the benchmarks.
+ * bestSeconds keeps the best of a few repetitions, for the long measures. For the operations taking a few
+ * nanoseconds, measure runs a batch of them many times after a warmup, and gives the median and the 99th percentile
+ * of the time per operation, and the median number of cycles per operation (reference cycles counted by rdtsc, on
+ * x86 only). When the BENCH_RESULTS environment variable names a file, report also appends each measure to it as a
+ * CSV line, for the tracking of regressions :
+ *     benchmark,case,median_ns,p99_ns,median_cycles
+ */
+
+namespace Bench
+{
+
+// Prevent the compiler from optimizing away a computed value.
+template<class T>
+inline void doNotOptimize(const T& value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template<class Fn>
+double bestSeconds(Fn&& fn, size_t repetitions = 5)
+{
+	double best = 1e300;
+	for(size_t i = 0; i < repetitions; ++i)
+	{
+		auto start = std::chrono::steady_clock::now();
+		fn();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::min(best, elapsed.count());
+	}
+	return best;
+}
+
+inline void reportThroughput(const char* name, size_t bytes, double seconds)
+{
+	std::printf("%-40s %10.3f ms %10.3f GB/s\n", name, seconds * 1e3, bytes / seconds / 1e9);
+}
+
+inline void reportOperations(const char* name, size_t operations, double seconds)
+{
+	std::printf("%-40s %10.3f ms %10.3f ns/op\n", name, seconds * 1e3, seconds * 1e9 / operations);
+}
+
+// Time stamp counter, or 0 where there is none.
+inline uint64_t cycles()
+{
+#if BENCH_RDTSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+struct Measure
+{
+	double medianNs;
+	double p99Ns;
+	double medianCycles;
+};
+
+// Value at the given fraction of sorted values, without interpolation.
+inline double percentile(const std::vector<double>& sorted, double fraction)
+{
+	return sorted[std::min(sorted.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted.size())))];
+}
+
+// Each call of fn must do the given number of operations.
+template<class Fn>
+Measure measure(Fn&& fn, size_t operations, size_t samples = 1000, size_t warmup = 100)
+{
+	for(size_t i = 0; i < warmup; ++i)
+	{
+		fn();
+	}
+
+	std::vector<double> times(samples);
+	std::vector<double> counts(samples);
+	for(size_t i = 0; i < samples; ++i)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const uint64_t startCycles = cycles();
+		fn();
+		const uint64_t endCycles = cycles();
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		times[i] = elapsed.count() / static_cast<double>(operations);
+		counts[i] = static_cast<double>(endCycles - startCycles) / static_cast<double>(operations);
+	}
+	std::sort(times.begin(), times.end());
+	std::sort(counts.begin(), counts.end());
+	return {percentile(times, 0.5), percentile(times, 0.99), percentile(counts, 0.5)};
+}
+
+inline void report(const char* benchmark, const char* name, const Measure& result)
+{
+	std::printf("%-40s %10.3f ns/op (p99 %10.3f) %10.1f cycles/op\n", name, result.medianNs, result.p99Ns, result.medianCycles);
+	if(const char* path = std::getenv("BENCH_RESULTS"))
+	{
+		if(FILE* file = std::fopen(path, "a"))
+		{
+			std::fprintf(file, "%s,%s,%.3f,%.3f,%.1f\n", benchmark, name, result.medianNs, result.p99Ns, result.medianCycles);
+			std::fclose(file);
+		}
+	}
+}
+
+// Number of instructions between the label of the function and the end of its body in the assembly
+// generated with -S, for the functions with C linkage, whose label is their name.
+inline size_t countInstructions(const std::string& assembly, const std::string& function)
+{
+	std::istringstream lines{assembly};
+	std::string line;
+	bool inFunction = false;
+	size_t count = 0;
+	while(std::getline(lines, line))
+	{
+		if(line == function + ":")
+		{
+			inFunction = true;
+		}
+		else if(inFunction && line.find(".size") != std::string::npos && line.find(function) != std::string::npos)
+		{
+			break;
+		}
+		// Instructions are indented, and directives start with a dot.
+		else if(inFunction && line.size() > 1 && line[0] == '\t' && line[1] != '.')
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+}
+
+#endif // BENCHMARK_HXX
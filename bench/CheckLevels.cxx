@@ -0,0 +1,150 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Benchmark.hxx"
+
+/* Cost of the checks on iteration heavy code, for each CONSTEXPR_CHECK_LEVEL.
+ * The same program, indexing a StaticString, iterating over it with its iterators, and popping a range to its end,
+ * is generated, compiled with -O2 for each level, then run : it prints its own timings. Each loop is in a function of
+ * its own, and the loops and functions are aligned on 64 bytes, so that the code placed before them, like the out of
+ * line failure of the checks, does not move them across cache lines and fetch blocks from a level to the other. The
+ * instructions of each function are counted in the assembly, and reported next to its time : at equal counts, a
+ * difference of time is noise, not the cost of the checks. The compiler is taken from the CXX environment variable
+ * (c++ by default), and the include folder of the library can be given as first argument (include, from the root of
+ * the repository, by default).
+ */
+
+namespace
+{
+
+constexpr const char* loops[] = {"countIndexing", "countIterators", "countRangePopping"};
+
+const char* source = R"(#include <cstdio>
+#include <cstdlib>
+#include <Range.hxx>
+#include <StaticString.hxx>
+#include "Benchmark.hxx"
+
+using String = StaticString<4096>;
+
+extern "C" __attribute__((noinline)) size_t countIndexing(const String& str)
+{
+	size_t count = 0;
+	for(size_t index = 0; index < str.size(); ++index)
+	{
+		count += str[index] == 'a';
+	}
+	return count;
+}
+
+extern "C" __attribute__((noinline)) size_t countIterators(const String& str)
+{
+	size_t count = 0;
+	for(char c : str)
+	{
+		count += c == 'a';
+	}
+	return count;
+}
+
+extern "C" __attribute__((noinline)) size_t countRangePopping(const String& str)
+{
+	size_t count = 0;
+	for(range<String::const_iterator> rg{str.begin(), str.end()}; !rg.empty(); rg.pop_front())
+	{
+		count += rg.front() == 'a';
+	}
+	return count;
+}
+
+// The instructions of the function, counted from the assembly, are given as argument.
+template<class Fn>
+void run(const char* name, const char* instructions, const String& str, size_t& count, Fn fn)
+{
+	constexpr size_t repetitions = 20000;
+	const double seconds = Bench::bestSeconds([&]() {
+		for(size_t i = 0; i < repetitions; ++i)
+		{
+			Bench::doNotOptimize(str);
+			count += fn(str);
+		}
+	});
+	std::printf("%-40s %10.3f ms %10.3f GB/s %6s instructions\n", name, seconds * 1e3, str.size() * repetitions / seconds / 1e9, instructions);
+}
+
+int main(int argc, char** argv)
+{
+	if(argc < 4)
+	{
+		return EXIT_FAILURE;
+	}
+	String str;
+	for(size_t i = 0; i < str.capacity(); ++i)
+	{
+		str.append<TruncationPolicy::Truncate>(ConstString{i % 2 ? "a" : "b"});
+	}
+
+	size_t count = 0;
+	run("Indexing", argv[1], str, count, countIndexing);
+	run("Iterators", argv[2], str, count, countIterators);
+	run("Range popping", argv[3], str, count, countRangePopping);
+
+	Bench::doNotOptimize(count);
+	return 0;
+}
+)";
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourcePath = directory / "CheckLevels.cxx";
+	const auto programPath = directory / "CheckLevels";
+	const auto assemblyPath = directory / "CheckLevels.s";
+	std::ofstream{sourcePath} << source;
+
+	std::printf("Compiler : %s\n", compiler);
+	int result = EXIT_SUCCESS;
+	// The checked iterators are asked for apart from the level, so they are measured with the full checks.
+	for(const char* level : {"-DCONSTEXPR_CHECK_LEVEL=CONSTEXPR_CHECK_NONE", "-DCONSTEXPR_CHECK_LEVEL=CONSTEXPR_CHECK_BOUNDS",
+							 "-DCONSTEXPR_CHECK_LEVEL=CONSTEXPR_CHECK_FULL", "-DCONSTEXPR_CHECK_LEVEL=CONSTEXPR_CHECK_FULL -DARRAY_ITERATOR_CHECKED=1"})
+	{
+		// The folder of this benchmark is given too, for Benchmark.hxx.
+		const std::string command = std::string{compiler} + " -std=c++20 -O2 -falign-functions=64 -falign-loops=64 -w " + level
+								  + " -I" + includeDir + " -I" + includeDir + "/../bench " + sourcePath.string();
+		std::printf("%s\n", level);
+		std::fflush(stdout);
+		if(std::system((command + " -S -o " + assemblyPath.string()).c_str()) != 0
+		|| std::system((command + " -o " + programPath.string()).c_str()) != 0)
+		{
+			std::printf("Compilation with %s failed\n", level);
+			result = EXIT_FAILURE;
+			break;
+		}
+
+		std::stringstream assembly;
+		assembly << std::ifstream{assemblyPath}.rdbuf();
+		std::string run = programPath.string();
+		for(const char* loop : loops)
+		{
+			run += ' ' + std::to_string(Bench::countInstructions(assembly.str(), loop));
+		}
+		if(std::system(run.c_str()) != 0)
+		{
+			std::printf("Run with %s failed\n", level);
+			result = EXIT_FAILURE;
+			break;
+		}
+	}
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(programPath);
+	std::filesystem::remove(assemblyPath);
+	return result;
+}
@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Compile-time cost of declaring enumerations, to compare the macros before and after a change.
+ * For each number of enumerators (10, 100, 1000 and 4000) and of enumerations per translation unit (1, 50 and 500),
+ * a translation unit declaring them with IMPROVED_ENUM, with a function converting each of them to a string, is
+ * generated and compiled to an object file with -O2. The time of the main phases is read from the report of the
+ * compiler (-ftime-report for gcc, -ftime-trace for clang), and the peak memory of the compiler from the operating
+ * system. A preprocessing of a single enumeration first tells whether the macros can expand that many enumerators.
+ * The compiler is taken from the CXX environment variable (c++ by default), and the include folder of the library
+ * can be given as first argument (include, from the root of the repository, by default). The largest translation
+ * units take minutes to build : the number of enumerators per translation unit can be bounded by a second argument.
+ */
+
+namespace
+{
+
+struct Phases
+{
+	// Seconds, negative when the compiler does not report the phase.
+	double preprocessing = -1;
+	double parsing = -1;
+	double instantiation = -1;
+	double constantEvaluation = -1;
+	double codegen = -1;
+	double total = -1;
+};
+
+std::string makeSource(size_t enumerators, size_t enumerations)
+{
+	std::string source = "#include <ImprovedEnum.hxx>\n";
+	for(size_t i = 0; i < enumerations; ++i)
+	{
+		const std::string name = "Enum" + std::to_string(i);
+		source += "IMPROVED_ENUM(" + name + ", uint16_t";
+		for(size_t j = 0; j < enumerators; ++j)
+		{
+			source += ", E" + std::to_string(j);
+		}
+		source += ");\n";
+		source += "ConstString toString(" + name + " value) { return value.to_string(); }\n";
+	}
+	return source;
+}
+
+std::string readFile(const std::filesystem::path& path)
+{
+	std::ifstream file{path};
+	return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+// Runs the command through the shell, and returns its exit status and the peak resident memory, in KiB, of the
+// command and its children.
+int runCommand(const std::string& command, long& peakKiB)
+{
+	const pid_t pid = fork();
+	if(pid == 0)
+	{
+		execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+		_exit(127);
+	}
+	int status = 0;
+	rusage usage{};
+	if(pid < 0 || wait4(pid, &status, 0, &usage) != pid)
+	{
+		return -1;
+	}
+	peakKiB = usage.ru_maxrss;
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+// Wall time of a line of the gcc report : "name : usr (pct) sys (pct) wall (pct) memory", without percentages for TOTAL.
+double gccPhase(const std::string& report, const std::string& name)
+{
+	std::istringstream lines{report};
+	for(std::string line; std::getline(lines, line);)
+	{
+		const size_t colon = line.find(':');
+		const size_t first = line.find_first_not_of(' ');
+		if(colon == std::string::npos || line.compare(first, name.size(), name) != 0
+		   || line.find_first_not_of(' ', first + name.size()) != colon)
+		{
+			continue;
+		}
+		double user, system, wall;
+		if(std::sscanf(line.c_str() + colon + 1, "%lf (%*[^)]) %lf (%*[^)]) %lf", &user, &system, &wall) == 3
+		   || std::sscanf(line.c_str() + colon + 1, "%lf %lf %lf", &user, &system, &wall) == 3)
+		{
+			return wall;
+		}
+	}
+	return -1;
+}
+
+// Duration of a "Total ..." event of the clang trace, which are complete events with a duration in microseconds.
+double clangPhase(const std::string& trace, const std::string& name)
+{
+	const size_t position = trace.find("\"name\":\"Total " + name + "\"");
+	if(position == std::string::npos)
+	{
+		return -1;
+	}
+	const size_t event = trace.rfind('{', position);
+	const size_t duration = trace.find("\"dur\":", event);
+	return duration < trace.find('}', position) ? std::strtod(trace.c_str() + duration + 6, nullptr) / 1e6 : -1;
+}
+
+Phases gccPhases(const std::string& report)
+{
+	Phases phases;
+	phases.preprocessing = gccPhase(report, "preprocessing");
+	phases.parsing = gccPhase(report, "phase parsing");
+	phases.instantiation = gccPhase(report, "template instantiation");
+	phases.constantEvaluation = gccPhase(report, "constant expression evaluation");
+	phases.codegen = gccPhase(report, "phase opt and generate");
+	phases.total = gccPhase(report, "TOTAL");
+	return phases;
+}
+
+Phases clangPhases(const std::string& trace)
+{
+	Phases phases;
+	phases.preprocessing = clangPhase(trace, "Source");
+	phases.parsing = clangPhase(trace, "Frontend");
+	const double classes = clangPhase(trace, "InstantiateClass");
+	const double functions = clangPhase(trace, "InstantiateFunction");
+	phases.instantiation = classes < 0 && functions < 0 ? -1 : std::max(classes, 0.0) + std::max(functions, 0.0);
+	phases.codegen = clangPhase(trace, "Backend");
+	phases.total = clangPhase(trace, "ExecuteCompiler");
+	return phases;
+}
+
+void printSeconds(double seconds)
+{
+	if(seconds < 0)
+	{
+		std::printf(" %10s", "-");
+	}
+	else
+	{
+		std::printf(" %10.3f", seconds);
+	}
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+	const size_t maxEnumerators = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : SIZE_MAX;
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourcePath = directory / "EnumCompile.cxx";
+	const auto objectPath = directory / "EnumCompile.o";
+	const auto outputPath = directory / "EnumCompile.out";
+	const std::string redirect = " >" + outputPath.string() + " 2>&1";
+
+	long peakKiB = 0;
+	runCommand(std::string{compiler} + " --version" + redirect, peakKiB);
+	const bool clang = readFile(outputPath).find("clang") != std::string::npos;
+	const std::string base = std::string{compiler} + " -std=c++20 -w -I" + includeDir + " ";
+	const std::string reportFlag = clang ? " -ftime-trace" : " -ftime-report";
+
+	std::printf("Compiler : %s\n", compiler);
+	std::printf("%-24s %10s %10s %10s %10s %10s %10s %10s\n", "Enumerators x enums", "preprocess", "parse", "instantiate",
+				"constexpr", "codegen", "total (s)", "peak (MB)");
+	int result = EXIT_SUCCESS;
+	for(size_t enumerators : {size_t{10}, size_t{100}, size_t{1000}, size_t{4000}})
+	{
+		// Past the depth of expansion of the macros, the MAP helpers are left unexpanded.
+		std::ofstream{sourcePath} << makeSource(enumerators, 1);
+		const bool expands = runCommand(base + "-E " + sourcePath.string() + redirect, peakKiB) == 0
+							 && readFile(outputPath).find("ENUM_NAME_TUPLE_DECL") == std::string::npos;
+
+		for(size_t enumerations : {size_t{1}, size_t{50}, size_t{500}})
+		{
+			const std::string label = std::to_string(enumerators) + " x " + std::to_string(enumerations);
+			if(!expands)
+			{
+				std::printf("%-24s past the expansion limit of the macros\n", label.c_str());
+				continue;
+			}
+			if(enumerators * enumerations > maxEnumerators)
+			{
+				std::printf("%-24s skipped\n", label.c_str());
+				continue;
+			}
+
+			std::ofstream{sourcePath} << makeSource(enumerators, enumerations);
+			const std::string command = base + "-O2 -c" + reportFlag + " " + sourcePath.string() + " -o " + objectPath.string() + redirect;
+			if(runCommand(command, peakKiB) != 0)
+			{
+				std::printf("%-24s compilation failed\n", label.c_str());
+				result = EXIT_FAILURE;
+				continue;
+			}
+
+			const auto tracePath = std::filesystem::path{objectPath}.replace_extension(".json");
+			const Phases phases = clang ? clangPhases(readFile(tracePath)) : gccPhases(readFile(outputPath));
+			std::printf("%-24s", label.c_str());
+			for(double seconds : {phases.preprocessing, phases.parsing, phases.instantiation, phases.constantEvaluation, phases.codegen, phases.total})
+			{
+				printSeconds(seconds);
+			}
+			std::printf(" %10.1f\n", static_cast<double>(peakKiB) / 1024);
+			std::fflush(stdout);
+			std::filesystem::remove(tracePath);
+		}
+	}
+
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(objectPath);
+	std::filesystem::remove(outputPath);
+	return result;
+}
@@ -0,0 +1,141 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Benchmark.hxx"
+#include <ImprovedEnum.hxx>
+
+/* Iteration over an enum against a loop over the raw array of its values.
+ * First, both loops are compiled to assembly (-O1 and -O2 -S), once over the whole enum and once from a given
+ * enumerator, and the instructions of the functions are counted : the iteration is expected to have no overhead,
+ * so it must not take more instructions than the loop over the array. The compiler is taken from the CXX environment variable (c++ by default), and the
+ * include folder of the library can be given as first argument (include, from the root of the repository, by
+ * default).
+ * Then, both loops are timed in this build.
+ */
+
+IMPROVED_ENUM(BenchColor, uint8_t,
+	Red,
+	Green,
+	Blue,
+	Cyan = 7,
+	Magenta,
+	Yellow
+);
+
+namespace
+{
+
+const char* source =
+	"#include <ImprovedEnum.hxx>\n"
+	"IMPROVED_ENUM(Color, uint8_t, Red, Green, Blue, Cyan = 7, Magenta, Yellow);\n"
+	"using Value = Color::UnderlyingEnumType;\n"
+	"extern \"C\" unsigned sumEnum()\n"
+	"{\n"
+	"\tunsigned sum = 0;\n"
+	"\tfor(Color value : Color::iter()) sum += value.to_value();\n"
+	"\treturn sum;\n"
+	"}\n"
+	"extern \"C\" unsigned sumArray()\n"
+	"{\n"
+	"\tunsigned sum = 0;\n"
+	"\tfor(const Value* it = Color::values().data(); it != Color::values().data() + Color::size(); ++it) sum += *it;\n"
+	"\treturn sum;\n"
+	"}\n"
+	"extern \"C\" unsigned sumEnumFrom(Value from)\n"
+	"{\n"
+	"\tunsigned sum = 0;\n"
+	"\tfor(Color value : Color::iter_from(from)) sum += value.to_value();\n"
+	"\treturn sum;\n"
+	"}\n"
+	"extern \"C\" unsigned sumArrayFrom(Value from)\n"
+	"{\n"
+	"\tunsigned sum = 0;\n"
+	"\tfor(const Value* it = Color::values().data() + Color{from}.get_index(); it != Color::values().data() + Color::size(); ++it) sum += *it;\n"
+	"\treturn sum;\n"
+	"}\n";
+
+// Whether every loop over the enum compiles to at most as many instructions as the loop over the array.
+bool hasNoCodeOverhead(const char* compiler, const std::string& includeDir, const char* optimization)
+{
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourcePath = directory / "EnumIteration.cxx";
+	const auto assemblyPath = directory / "EnumIteration.s";
+	std::ofstream{sourcePath} << source;
+
+	const std::string command = std::string{compiler} + " -std=c++20 " + optimization + " -S -w -I" + includeDir + " " + sourcePath.string() + " -o " + assemblyPath.string();
+	const int status = std::system(command.c_str());
+	std::stringstream assembly;
+	assembly << std::ifstream{assemblyPath}.rdbuf();
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(assemblyPath);
+	if(status != 0)
+	{
+		std::printf("Compilation of the loops failed\n");
+		return false;
+	}
+
+	bool noOverhead = true;
+	for(const char* suffix : {"", "From"})
+	{
+		const size_t enumCount = Bench::countInstructions(assembly.str(), std::string{"sumEnum"} + suffix);
+		const size_t arrayCount = Bench::countInstructions(assembly.str(), std::string{"sumArray"} + suffix);
+		std::printf("%-6s %-30s %10zu instructions, %zu for the array\n", optimization, (std::string{"sumEnum"} + suffix).c_str(), enumCount, arrayCount);
+		noOverhead = noOverhead && enumCount <= arrayCount && enumCount != 0;
+	}
+	return noOverhead;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+
+	std::printf("Compiler : %s\n", compiler);
+	bool noOverhead = true;
+	for(const char* optimization : {"-O1", "-O2"})
+	{
+		noOverhead = hasNoCodeOverhead(compiler, includeDir, optimization) && noOverhead;
+	}
+	if(!noOverhead)
+	{
+		std::printf("The iteration over the enum compiles to more than the loop over the array\n");
+		return EXIT_FAILURE;
+	}
+
+	constexpr size_t repetitions = 10000000;
+	unsigned sum = 0;
+	// Hidden from the optimizer, so that the loops are not folded to constants.
+	unsigned factor = 3;
+	double seconds = Bench::bestSeconds([&]() {
+		for(size_t i = 0; i < repetitions; ++i)
+		{
+			Bench::doNotOptimize(factor);
+			for(BenchColor value : BenchColor::iter())
+			{
+				sum += value.to_value() * factor;
+			}
+			Bench::doNotOptimize(sum);
+		}
+	});
+	Bench::reportOperations("Enum iteration", repetitions * BenchColor::size(), seconds);
+
+	seconds = Bench::bestSeconds([&]() {
+		for(size_t i = 0; i < repetitions; ++i)
+		{
+			Bench::doNotOptimize(factor);
+			for(const auto* it = BenchColor::values().data(); it != BenchColor::values().data() + BenchColor::size(); ++it)
+			{
+				sum += *it * factor;
+			}
+			Bench::doNotOptimize(sum);
+		}
+	});
+	Bench::reportOperations("Array iteration", repetitions * BenchColor::size(), seconds);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Benchmark.hxx"
+#include <ConstString.hxx>
+#include <ImprovedEnum.hxx>
+#include <StaticString.hxx>
+
+/* The everyday operations of the library, against what would be written by hand : a switch, or a std::unordered_map
+ * built at startup, for the enumerations, and std::string_view or std::string for the strings.
+ * Every case goes over the same 1024 inputs, drawn at random with a fixed seed so that the branches are not
+ * predictable, and reports the median and 99th percentile of the time per operation, and the cycles per operation
+ * (see Benchmark.hxx, and BENCH_RESULTS to get them as CSV).
+ */
+
+IMPROVED_ENUM(HttpMethod, uint8_t,
+	Get,
+	Head,
+	Post,
+	Put,
+	Delete,
+	Connect = 10,
+	Options,
+	Trace,
+	Patch = 20
+);
+
+namespace
+{
+
+constexpr size_t inputCount = 1024;
+constexpr const char* benchmarkName = "EnumOperations";
+
+const char* switchToString(HttpMethod method)
+{
+	switch(method.to_value())
+	{
+		case HttpMethod::Get: return "Get";
+		case HttpMethod::Head: return "Head";
+		case HttpMethod::Post: return "Post";
+		case HttpMethod::Put: return "Put";
+		case HttpMethod::Delete: return "Delete";
+		case HttpMethod::Connect: return "Connect";
+		case HttpMethod::Options: return "Options";
+		case HttpMethod::Trace: return "Trace";
+		case HttpMethod::Patch: return "Patch";
+	}
+	return "";
+}
+
+bool switchIsValid(uint8_t value)
+{
+	switch(value)
+	{
+		case HttpMethod::Get: case HttpMethod::Head: case HttpMethod::Post: case HttpMethod::Put: case HttpMethod::Delete:
+		case HttpMethod::Connect: case HttpMethod::Options: case HttpMethod::Trace: case HttpMethod::Patch:
+			return true;
+	}
+	return false;
+}
+
+size_t switchIndex(HttpMethod method)
+{
+	switch(method.to_value())
+	{
+		case HttpMethod::Get: return 0;
+		case HttpMethod::Head: return 1;
+		case HttpMethod::Post: return 2;
+		case HttpMethod::Put: return 3;
+		case HttpMethod::Delete: return 4;
+		case HttpMethod::Connect: return 5;
+		case HttpMethod::Options: return 6;
+		case HttpMethod::Trace: return 7;
+		case HttpMethod::Patch: return 8;
+	}
+	return HttpMethod::size();
+}
+
+// Runs fn on each input, for a batch of inputCount operations.
+template<class Inputs, class Fn>
+auto overInputs(const Inputs& inputs, Fn fn)
+{
+	return [&inputs, fn] {
+		size_t sum = 0;
+		for(const auto& input : inputs)
+		{
+			sum += static_cast<size_t>(fn(input));
+		}
+		Bench::doNotOptimize(sum);
+	};
+}
+
+// The input after the given one, wrapping around.
+template<class T>
+const T& next(const std::array<T, inputCount>& inputs, const T& input)
+{
+	return inputs[static_cast<size_t>(&input - inputs.data() + 1) % inputCount];
+}
+
+template<class Inputs, class Fn>
+void run(const char* name, const Inputs& inputs, Fn fn)
+{
+	Bench::report(benchmarkName, name, Bench::measure(overInputs(inputs, fn), inputs.size()));
+}
+
+}
+
+int main()
+{
+	std::mt19937 generator{42};
+	std::uniform_int_distribution<size_t> pick{0, HttpMethod::size() - 1};
+
+	std::array<HttpMethod, inputCount> methods{};
+	std::array<uint8_t, inputCount> values{};
+	std::array<ConstString, inputCount> names{};
+	std::array<std::string_view, inputCount> views{};
+	for(size_t i = 0; i < inputCount; ++i)
+	{
+		methods[i] = HttpMethod::values()[pick(generator)];
+		values[i] = methods[i].to_value();
+		names[i] = methods[i].to_string();
+		views[i] = {names[i].data(), names[i].size()};
+	}
+
+	std::unordered_map<uint8_t, HttpMethod> byValue;
+	std::unordered_map<std::string_view, HttpMethod> byName;
+	for(HttpMethod method : HttpMethod::iter())
+	{
+		byValue.emplace(method.to_value(), method);
+		byName.emplace(std::string_view{method.to_string().data(), method.to_string().size()}, method);
+	}
+
+	run("to_string", methods, [](HttpMethod method) { return method.to_string().size(); });
+	run("to_string (switch)", methods, [](HttpMethod method) { return std::char_traits<char>::length(switchToString(method)); });
+
+	run("from_value", values, [](uint8_t value) { return HttpMethod::from_value(value).to_value(); });
+	run("try_from_value", values, [](uint8_t value) { return HttpMethod::try_from_value(value).has_value(); });
+	run("from_value (switch)", values, [](uint8_t value) { return switchIsValid(value); });
+	run("from_value (unordered_map)", values, [&](uint8_t value) { return byValue.find(value)->second.to_value(); });
+
+	run("from_string", names, [](ConstString name) { return HttpMethod::from_string(name).to_value(); });
+	run("from_string (unordered_map)", views, [&](std::string_view name) { return byName.find(name)->second.to_value(); });
+
+	run("get_index", methods, [](HttpMethod method) { return method.get_index(); });
+	run("get_index (switch)", methods, [](HttpMethod method) { return switchIndex(method); });
+
+	// A whole iteration per operation.
+	run("iter", methods, [](HttpMethod) {
+		unsigned sum = 0;
+		for(HttpMethod method : HttpMethod::iter())
+		{
+			sum += method.to_value();
+		}
+		return sum;
+	});
+	run("iter (array)", methods, [](HttpMethod) {
+		unsigned sum = 0;
+		for(auto value : HttpMethod::values())
+		{
+			sum += value;
+		}
+		return sum;
+	});
+
+	// Each name against the next one.
+	run("ConstString ==", names, [&names](const ConstString& name) { return name == next(names, name); });
+	run("string_view ==", views, [&views](const std::string_view& name) { return name == next(views, name); });
+	run("ConstString <=>", names, [&names](const ConstString& name) { return name < next(names, name); });
+	run("string_view <=>", views, [&views](const std::string_view& name) { return name < next(views, name); });
+
+	run("ConstString::find", names, [](ConstString name) { return static_cast<size_t>(name.find('t') - name.begin()); });
+	run("string_view::find", views, [](std::string_view name) { return name.find('t'); });
+
+	run("StaticString construction", names, [](ConstString name) {
+		StaticString<16> copy{name.begin(), name.end()};
+		Bench::doNotOptimize(copy);
+		return copy.size();
+	});
+	run("std::string construction", views, [](std::string_view name) {
+		std::string copy{name};
+		Bench::doNotOptimize(copy);
+		return copy.size();
+	});
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+#include <cstring>
+#include <random>
+#include <string>
+
+#include <ImprovedEnum.hxx>
+#include <EnumScanner.hxx>
+
+#include "Benchmark.hxx"
+
+IMPROVED_ENUM(ErrorCode, uint16_t,
+	ConnectionRefused,
+	ConnectionReset,
+	HostUnreachable,
+	Timeout,
+	BrokenPipe,
+	PermissionDenied,
+	FileNotFound,
+	DiskFull,
+	OutOfMemory,
+	InvalidArgument,
+	NotImplemented,
+	Interrupted,
+	WouldBlock,
+	AddressInUse,
+	ProtocolError,
+	Unknown
+);
+
+namespace
+{
+
+std::string generateLog(size_t size)
+{
+	static const char* const words[] = {
+		"request", "served", "in", "ms", "user", "session", "opened", "closed", "GET", "POST", "/api/v1/items",
+		"status", "200", "upstream", "latency", "cache", "hit", "miss", "worker", "queue", "depth"
+	};
+
+	std::mt19937 rng{42};
+	std::string log;
+	log.reserve(size + 64);
+
+	while(log.size() < size)
+	{
+		// Roughly one error name every hundred words.
+		if(rng() % 100 == 0)
+		{
+			log += ErrorCode::names()[rng() % ErrorCode::size()];
+		}
+		else
+		{
+			log += words[rng() % (sizeof(words) / sizeof(words[0]))];
+		}
+		log += (rng() % 12 == 0 ? '\n' : ' ');
+	}
+	log.resize(size);
+	return log;
+}
+
+}
+
+int main()
+{
+	constexpr size_t logSize = 64 * 1024 * 1024;
+	constexpr size_t chunkSize = 64 * 1024;
+
+	const std::string log = generateLog(logSize);
+
+	size_t scannerHits = 0;
+	double scannerTime = Bench::bestSeconds([&]() {
+		EnumUtils::Scanner<ErrorCode> scanner;
+		scannerHits = 0;
+		for(size_t offset = 0; offset < log.size(); offset += chunkSize)
+		{
+			std::string_view chunk{log.data() + offset, std::min(chunkSize, log.size() - offset)};
+			scanner.scan(chunk, [&scannerHits](size_t, ErrorCode) { ++scannerHits; });
+		}
+		Bench::doNotOptimize(scannerHits);
+	});
+
+	size_t naiveHits = 0;
+	double naiveTime = Bench::bestSeconds([&]() {
+		naiveHits = 0;
+		for(const auto& name : ErrorCode::names())
+		{
+			for(const char* it = std::strstr(log.c_str(), name); it != nullptr; it = std::strstr(it + 1, name))
+			{
+				++naiveHits;
+			}
+		}
+		Bench::doNotOptimize(naiveHits);
+	});
+
+	Bench::reportThroughput("EnumUtils::Scanner (64KiB chunks)", log.size(), scannerTime);
+	Bench::reportThroughput("strstr loop per name", log.size(), naiveTime);
+
+	if(scannerHits != naiveHits)
+	{
+		std::printf("Mismatch : scanner found %zu names, strstr found %zu\n", scannerHits, naiveHits);
+		return 1;
+	}
+	std::printf("%zu names found\n", scannerHits);
+	return 0;
+}
@@ -0,0 +1,428 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxabi.h>
+#include <elf.h>
+
+/* Binary size of the enumerations, per enumeration and per feature.
+ * For a few numbers of enumerators, translation units declaring an enumeration with a plain enum class,
+ * ITERABLE_ENUM or IMPROVED_ENUM, and using some of its features, are compiled to object files (-O2, one section per
+ * function and per variable). The sizes of their sections are read from the ELF files, and reported as the bytes
+ * added over the plain enum class, in code (.text), constants (.rodata and .data.rel.ro), variables (.data and
+ * .bss), and other loaded data (mostly unwinding tables). Then the symbols of one of these enumerations are listed.
+ * Last, the linked program of two translation units using the same enumeration is checked for regressions : no symbol
+ * must be defined twice (per translation unit copies of a name table, or of the Looper instantiations, are local
+ * symbols of the same name), and the names and the values of the enumerators must be stored once.
+ * The compiler is taken from the CXX environment variable (c++ by default), and the include folder of the library
+ * can be given as first argument (include, from the root of the repository, by default). Only 64 bits ELF files, as
+ * built on Linux, are read.
+ */
+
+namespace
+{
+
+constexpr const char* enumName = "Sized";
+
+enum class Declaration
+{
+	Plain,
+	Iterable,
+	Improved
+};
+
+enum Feature : unsigned
+{
+	None = 0,
+	Iteration = 1,
+	ToString = 2,
+	FromString = 4,
+	FromValue = 8
+};
+
+struct Variant
+{
+	const char* label;
+	Declaration declaration;
+	unsigned features;
+};
+
+constexpr Variant variants[] = {
+	{"enum class", Declaration::Plain, None},
+	{"ITERABLE_ENUM", Declaration::Iterable, None},
+	{"ITERABLE_ENUM, iter()", Declaration::Iterable, Iteration},
+	{"IMPROVED_ENUM", Declaration::Improved, None},
+	{"IMPROVED_ENUM, iter()", Declaration::Improved, Iteration},
+	{"IMPROVED_ENUM, to_string()", Declaration::Improved, ToString},
+	{"IMPROVED_ENUM, from_string()", Declaration::Improved, FromString},
+	{"IMPROVED_ENUM, from_value()", Declaration::Improved, FromValue},
+	{"IMPROVED_ENUM, all", Declaration::Improved, Iteration | ToString | FromString | FromValue}
+};
+
+enum class SectionKind
+{
+	Text,
+	Constants,
+	Variables,
+	Other,
+	None
+};
+
+struct Sizes
+{
+	uint64_t text = 0;
+	uint64_t constants = 0;
+	uint64_t variables = 0;
+	uint64_t other = 0;
+};
+
+struct Symbol
+{
+	std::string name;
+	uint64_t size;
+	bool local;
+	SectionKind kind;
+};
+
+struct ElfFile
+{
+	bool valid = false;
+	Sizes sizes;
+	std::vector<Symbol> symbols;
+	// Contents of the loaded sections holding data.
+	std::string data;
+};
+
+std::string enumerators(size_t count)
+{
+	std::string list;
+	for(size_t i = 0; i < count; ++i)
+	{
+		list += (i == 0 ? "Value" : ", Value") + std::to_string(i);
+	}
+	return list;
+}
+
+std::string makeDeclaration(Declaration declaration, size_t count)
+{
+	switch(declaration)
+	{
+		case Declaration::Plain: return "enum class " + std::string{enumName} + " : uint16_t { " + enumerators(count) + " };\n";
+		case Declaration::Iterable: return "ITERABLE_ENUM(" + std::string{enumName} + ", uint16_t, " + enumerators(count) + ");\n";
+		case Declaration::Improved: return "IMPROVED_ENUM(" + std::string{enumName} + ", uint16_t, " + enumerators(count) + ");\n";
+	}
+	return {};
+}
+
+// Out of line functions using the features, taking runtime values so that nothing is folded.
+std::string makeUses(unsigned features, const std::string& suffix)
+{
+	const std::string name{enumName};
+	std::string uses;
+	if(features & Iteration)
+	{
+		uses += "unsigned sum" + suffix + "() { unsigned sum = 0; for(" + name + " value : " + name + "::iter()) sum += value.to_value(); return sum; }\n";
+	}
+	if(features & ToString)
+	{
+		uses += "ConstString toString" + suffix + "(" + name + " value) { return value.to_string(); }\n";
+	}
+	if(features & FromString)
+	{
+		uses += name + " fromString" + suffix + "(ConstString str) { return " + name + "::from_string(str); }\n";
+	}
+	if(features & FromValue)
+	{
+		uses += name + " fromValue" + suffix + "(uint16_t value) { return " + name + "::from_value(value); }\n";
+	}
+	return uses;
+}
+
+std::string demangle(const std::string& name)
+{
+	int status = 0;
+	std::unique_ptr<char, decltype(&std::free)> demangled{abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status), &std::free};
+	return status == 0 ? std::string{demangled.get()} : name;
+}
+
+SectionKind classify(const std::string& name, uint64_t flags)
+{
+	if(!(flags & SHF_ALLOC))
+	{
+		return SectionKind::None;
+	}
+	const auto startsWith = [&name](const char* prefix) { return name.compare(0, std::strlen(prefix), prefix) == 0; };
+	if(startsWith(".text"))
+	{
+		return SectionKind::Text;
+	}
+	if(startsWith(".rodata") || startsWith(".data.rel.ro"))
+	{
+		return SectionKind::Constants;
+	}
+	if(startsWith(".data") || startsWith(".bss") || startsWith(".tdata") || startsWith(".tbss"))
+	{
+		return SectionKind::Variables;
+	}
+	return SectionKind::Other;
+}
+
+ElfFile readElf(const std::filesystem::path& path)
+{
+	ElfFile elf;
+	std::ifstream stream{path, std::ios::binary};
+	const std::string file{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+	if(file.size() < sizeof(Elf64_Ehdr) || std::memcmp(file.data(), ELFMAG, SELFMAG) != 0 || file[EI_CLASS] != ELFCLASS64)
+	{
+		return elf;
+	}
+
+	Elf64_Ehdr header;
+	std::memcpy(&header, file.data(), sizeof(header));
+	if(header.e_shoff + header.e_shnum * sizeof(Elf64_Shdr) > file.size() || header.e_shstrndx >= header.e_shnum)
+	{
+		return elf;
+	}
+	std::vector<Elf64_Shdr> sections(header.e_shnum);
+	std::memcpy(sections.data(), file.data() + header.e_shoff, sections.size() * sizeof(Elf64_Shdr));
+	const auto stringAt = [&file](const Elf64_Shdr& table, size_t offset) { return std::string{file.c_str() + table.sh_offset + offset}; };
+
+	std::vector<SectionKind> kinds(sections.size());
+	for(size_t i = 0; i < sections.size(); ++i)
+	{
+		const Elf64_Shdr& section = sections[i];
+		kinds[i] = classify(stringAt(sections[header.e_shstrndx], section.sh_name), section.sh_flags);
+		switch(kinds[i])
+		{
+			case SectionKind::Text: elf.sizes.text += section.sh_size; break;
+			case SectionKind::Constants: elf.sizes.constants += section.sh_size; break;
+			case SectionKind::Variables: elf.sizes.variables += section.sh_size; break;
+			case SectionKind::Other: elf.sizes.other += section.sh_size; break;
+			case SectionKind::None: break;
+		}
+		if((kinds[i] == SectionKind::Constants || kinds[i] == SectionKind::Variables) && section.sh_type != SHT_NOBITS)
+		{
+			elf.data.append(file, section.sh_offset, section.sh_size);
+		}
+	}
+
+	for(const Elf64_Shdr& table : sections)
+	{
+		if(table.sh_type != SHT_SYMTAB)
+		{
+			continue;
+		}
+		for(size_t offset = 0; offset + sizeof(Elf64_Sym) <= table.sh_size; offset += sizeof(Elf64_Sym))
+		{
+			Elf64_Sym symbol;
+			std::memcpy(&symbol, file.data() + table.sh_offset + offset, sizeof(symbol));
+			const unsigned type = ELF64_ST_TYPE(symbol.st_info);
+			if((type != STT_FUNC && type != STT_OBJECT) || symbol.st_shndx == SHN_UNDEF || symbol.st_shndx >= kinds.size())
+			{
+				continue;
+			}
+			elf.symbols.push_back({stringAt(sections[table.sh_link], symbol.st_name), symbol.st_size,
+								   ELF64_ST_BIND(symbol.st_info) == STB_LOCAL, kinds[symbol.st_shndx]});
+		}
+	}
+	elf.valid = true;
+	return elf;
+}
+
+const char* kindName(SectionKind kind)
+{
+	switch(kind)
+	{
+		case SectionKind::Text: return "text";
+		case SectionKind::Constants: return "const";
+		case SectionKind::Variables: return "data";
+		default: return "other";
+	}
+}
+
+class Builder
+{
+public:
+	Builder(const char* compiler, const std::string& includeDir)
+	: command_{std::string{compiler} + " -std=c++20 -O2 -w -ffunction-sections -fdata-sections -I" + includeDir},
+	  directory_{std::filesystem::temp_directory_path() / "EnumSize"}
+	{
+		std::filesystem::create_directories(directory_);
+	}
+
+	~Builder()
+	{
+		std::filesystem::remove_all(directory_);
+	}
+
+	std::filesystem::path write(const std::string& name, const std::string& source) const
+	{
+		const auto path = directory_ / name;
+		std::ofstream{path} << source;
+		return path;
+	}
+
+	// Object file of the source, or an invalid ElfFile if it does not build.
+	ElfFile compile(const std::string& source) const
+	{
+		const auto sourcePath = write("Sized.cxx", source);
+		const auto objectPath = directory_ / "Sized.o";
+		if(std::system((command_ + " -c " + sourcePath.string() + " -o " + objectPath.string()).c_str()) != 0)
+		{
+			return {};
+		}
+		return readElf(objectPath);
+	}
+
+	ElfFile link(const std::vector<std::filesystem::path>& sources) const
+	{
+		const auto programPath = directory_ / "Sized";
+		std::string command = command_;
+		for(const auto& source : sources)
+		{
+			command += ' ';
+			command += source.string();
+		}
+		if(std::system((command + " -o " + programPath.string()).c_str()) != 0)
+		{
+			return {};
+		}
+		return readElf(programPath);
+	}
+
+private:
+	std::string command_;
+	std::filesystem::path directory_;
+};
+
+std::string makeSource(const Variant& variant, size_t count)
+{
+	return "#include <ImprovedEnum.hxx>\n" + makeDeclaration(variant.declaration, count) + makeUses(variant.features, "");
+}
+
+long long delta(uint64_t size, uint64_t baseline)
+{
+	return static_cast<long long>(size) - static_cast<long long>(baseline);
+}
+
+// Two translation units using the same enumeration through a shared header, linked together.
+bool checkRegressions(const Builder& builder, size_t count)
+{
+	const unsigned features = Iteration | ToString | FromString | FromValue;
+	const auto header = builder.write("Sized.hxx", "#include <ImprovedEnum.hxx>\n" + makeDeclaration(Declaration::Improved, count));
+	const std::string include = "#include \"" + header.string() + "\"\n";
+	const auto first = builder.write("First.cxx", include + makeUses(features, "1"));
+	const auto second = builder.write("Second.cxx", include + makeUses(features, "2"));
+	const auto main = builder.write("Main.cxx", "int main() { return 0; }\n");
+	const ElfFile program = builder.link({first, second, main});
+	if(!program.valid)
+	{
+		std::printf("The program of two translation units does not build\n");
+		return false;
+	}
+
+	bool passed = true;
+	std::map<std::string, size_t> definitions;
+	for(const Symbol& symbol : program.symbols)
+	{
+		++definitions[symbol.name];
+	}
+	for(const auto& [name, times] : definitions)
+	{
+		if(times > 1)
+		{
+			std::printf("Regression : %s is defined %zu times\n", demangle(name).c_str(), times);
+			passed = false;
+		}
+	}
+
+	const std::string lastName = "Value" + std::to_string(count - 1);
+	size_t copies = 0;
+	for(size_t position = program.data.find(lastName); position != std::string::npos; position = program.data.find(lastName, position + 1))
+	{
+		++copies;
+	}
+	if(copies != 1)
+	{
+		std::printf("Regression : the names of the enumerators are stored %zu times\n", copies);
+		passed = false;
+	}
+	// The values, as stored by the enumeration, in the order of their declaration.
+	std::vector<uint16_t> values(count);
+	for(size_t i = 0; i < count; ++i)
+	{
+		values[i] = static_cast<uint16_t>(i);
+	}
+	const std::string valueTable{reinterpret_cast<const char*>(values.data()), values.size() * sizeof(uint16_t)};
+	size_t valueCopies = 0;
+	for(size_t position = program.data.find(valueTable); position != std::string::npos; position = program.data.find(valueTable, position + 1))
+	{
+		++valueCopies;
+	}
+	if(valueCopies > 1)
+	{
+		std::printf("Regression : the values of the enumerators are stored %zu times\n", valueCopies);
+		passed = false;
+	}
+	std::printf("%-40s %s\n", "Two translation units, linked", passed ? "no duplicated symbol, name nor value table" : "failed");
+	return passed;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+	const Builder builder{compiler, includeDir};
+
+	std::printf("Compiler : %s\n", compiler);
+	for(size_t count : {size_t{8}, size_t{64}, size_t{200}})
+	{
+		std::printf("\n%zu enumerators, bytes over a plain enum class\n", count);
+		std::printf("%-40s %10s %10s %10s %10s\n", "", "text", "const", "data", "other");
+		Sizes baseline;
+		for(const Variant& variant : variants)
+		{
+			const ElfFile object = builder.compile(makeSource(variant, count));
+			if(!object.valid)
+			{
+				std::printf("%-40s does not build\n", variant.label);
+				return EXIT_FAILURE;
+			}
+			if(variant.declaration == Declaration::Plain)
+			{
+				baseline = object.sizes;
+				continue;
+			}
+			std::printf("%-40s %10lld %10lld %10lld %10lld\n", variant.label, delta(object.sizes.text, baseline.text),
+						delta(object.sizes.constants, baseline.constants), delta(object.sizes.variables, baseline.variables),
+						delta(object.sizes.other, baseline.other));
+		}
+	}
+
+	constexpr size_t listedCount = 64;
+	std::printf("\nSymbols of an IMPROVED_ENUM of %zu enumerators, using all its features\n", listedCount);
+	ElfFile object = builder.compile(makeSource(variants[std::size(variants) - 1], listedCount));
+	std::sort(object.symbols.begin(), object.symbols.end(), [](const Symbol& lhs, const Symbol& rhs) { return lhs.size > rhs.size; });
+	for(const Symbol& symbol : object.symbols)
+	{
+		const std::string name = demangle(symbol.name);
+		if(symbol.size != 0 && name.find(enumName) != std::string::npos)
+		{
+			std::printf("%10llu %-5s %s%s\n", static_cast<unsigned long long>(symbol.size), kindName(symbol.kind), name.c_str(), symbol.local ? " (local)" : "");
+		}
+	}
+
+	std::printf("\n");
+	return checkRegressions(builder, listedCount) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,87 @@
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <FixedStringMap.hxx>
+
+#include "Benchmark.hxx"
+
+/* Lookups of short identifiers in a FixedStringMap, against std::unordered_map<std::string, T>.
+ * Half of the lookups hit, the other half miss, for dictionaries from a handful of keys to a few thousands.
+ */
+
+namespace
+{
+
+std::vector<std::string> makeKeys(size_t count, const char* prefix)
+{
+	std::vector<std::string> keys;
+	for(size_t i = 0; i < count; ++i)
+	{
+		keys.push_back(prefix + std::to_string(i * 2654435761u % 100000));
+	}
+	return keys;
+}
+
+void benchSize(size_t size)
+{
+	constexpr size_t lookups = 4 * 1024 * 1024;
+	const auto keys = makeKeys(size, "id_");
+	const auto missing = makeKeys(size, "no_");
+
+	FixedStringMap<15, size_t> fixedMap;
+	std::unordered_map<std::string, size_t> standardMap;
+	for(size_t i = 0; i < size; ++i)
+	{
+		fixedMap[keys[i]] = i;
+		standardMap[keys[i]] = i;
+	}
+
+	// The queries are std::string in both cases, as they would come from parsed text.
+	std::vector<std::string> queries;
+	for(size_t i = 0; i < 4096; ++i)
+	{
+		queries.push_back(i % 2 == 0 ? keys[i * 7 % size] : missing[i * 7 % size]);
+	}
+
+	char name[64];
+	size_t fixedFound = 0;
+	double seconds = Bench::bestSeconds([&]() {
+		fixedFound = 0;
+		for(size_t i = 0; i < lookups; ++i)
+		{
+			fixedFound += fixedMap.contains(queries[i % queries.size()]);
+		}
+		Bench::doNotOptimize(fixedFound);
+	});
+	std::snprintf(name, sizeof(name), "FixedStringMap (%zu keys)", size);
+	Bench::reportOperations(name, lookups, seconds);
+
+	size_t standardFound = 0;
+	seconds = Bench::bestSeconds([&]() {
+		standardFound = 0;
+		for(size_t i = 0; i < lookups; ++i)
+		{
+			standardFound += standardMap.find(queries[i % queries.size()]) != standardMap.end();
+		}
+		Bench::doNotOptimize(standardFound);
+	});
+	std::snprintf(name, sizeof(name), "std::unordered_map (%zu keys)", size);
+	Bench::reportOperations(name, lookups, seconds);
+
+	if(fixedFound != standardFound)
+	{
+		std::printf("Mismatch between the maps for %zu keys\n", size);
+	}
+}
+
+}
+
+int main()
+{
+	benchSize(8);
+	benchSize(64);
+	benchSize(4096);
+	return 0;
+}
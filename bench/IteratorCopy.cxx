@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "Benchmark.hxx"
+#include <StaticString.hxx>
+
+/* Copy of a StaticString through its iterators.
+ * First, functions copying a StaticString with std::copy and std::ranges::copy are compiled to assembly (-O2 -DNDEBUG
+ * -S, as in release builds, where the iterators are the pointers), and each one is reported as lowered or not to a
+ * call to memmove or memcpy, along with the same copy over the pointers given by data(). The benchmark fails if a copy
+ * through the iterators is not lowered while the one through the pointers is : not all standard libraries lower every
+ * copy (libstdc++ 12 does not for std::ranges::copy from const elements), but the iterators must not be the reason.
+ * The compiler is taken from the CXX environment variable (c++ by default), and the include folder of the library can
+ * be given as first argument (include, from the root of the repository, by default).
+ * Then, the copies through the iterators of this build, checked or not, are timed against a plain memcpy.
+ */
+
+namespace
+{
+
+constexpr size_t stringSize = 4096;
+using String = StaticString<stringSize>;
+
+// Whether the assembly of a function copying src in dst with the given statement calls memmove or memcpy.
+bool isLoweredToMemmove(const char* compiler, const std::string& includeDir, const char* statement)
+{
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourcePath = directory / "IteratorCopy.cxx";
+	const auto assemblyPath = directory / "IteratorCopy.s";
+	std::ofstream{sourcePath} << "#include <algorithm>\n"
+								 "#include <StaticString.hxx>\n"
+								 "void copyString(const StaticString<4096>& src, StaticString<4096>& dst)\n"
+								 "{\n\t" << statement << ";\n}\n";
+
+	const std::string command = std::string{compiler} + " -std=c++20 -O2 -DNDEBUG -S -w -I" + includeDir + " " + sourcePath.string() + " -o " + assemblyPath.string();
+	const int status = std::system(command.c_str());
+	std::stringstream assembly;
+	assembly << std::ifstream{assemblyPath}.rdbuf();
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(assemblyPath);
+	if(status != 0)
+	{
+		std::printf("Compilation of %s failed\n", statement);
+		std::exit(EXIT_FAILURE);
+	}
+
+	const std::string text = assembly.str();
+	return text.find("memmove") != std::string::npos || text.find("memcpy") != std::string::npos;
+}
+
+template<class Fn>
+void benchCopy(const char* name, Fn&& copy)
+{
+	constexpr size_t repetitions = 100000;
+	String src;
+	src.resize(stringSize);
+	std::fill(src.begin(), src.end(), 'a');
+	String dst;
+	dst.resize(stringSize);
+
+	double seconds = Bench::bestSeconds([&]() {
+		for(size_t i = 0; i < repetitions; ++i)
+		{
+			Bench::doNotOptimize(src);
+			copy(src, dst);
+			Bench::doNotOptimize(dst);
+		}
+	});
+	Bench::reportThroughput(name, stringSize * repetitions, seconds);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+
+	std::printf("Compiler : %s\n", compiler);
+	std::printf("%-50s %10s %10s\n", "Copy", "iterators", "pointers");
+	int result = EXIT_SUCCESS;
+	// The copy through the iterators, and the same one through the pointers.
+	const std::pair<const char*, const char*> statements[] = {
+		{"std::copy(src.begin(), src.end(), dst.begin())", "std::copy(src.data(), src.data() + src.size(), dst.data())"},
+		{"std::ranges::copy(src, dst.begin())", "std::ranges::copy(src.data(), src.data() + src.size(), dst.data())"}
+	};
+	for(const auto& [iterators, pointers] : statements)
+	{
+		const bool iteratorsLowered = isLoweredToMemmove(compiler, includeDir, iterators);
+		const bool pointersLowered = isLoweredToMemmove(compiler, includeDir, pointers);
+		std::printf("%-50s %10s %10s\n", iterators, iteratorsLowered ? "memmove" : "loop", pointersLowered ? "memmove" : "loop");
+		if(pointersLowered && !iteratorsLowered)
+		{
+			result = EXIT_FAILURE;
+		}
+	}
+
+	benchCopy("std::copy", [](const String& src, String& dst) { std::copy(src.begin(), src.end(), dst.begin()); });
+	benchCopy("std::ranges::copy", [](const String& src, String& dst) { std::ranges::copy(src, dst.begin()); });
+	benchCopy("std::copy of the pointers", [](const String& src, String& dst) { std::copy(src.data(), src.data() + src.size(), dst.data()); });
+	benchCopy("memcpy", [](const String& src, String& dst) { std::memcpy(dst.data(), src.data(), stringSize); });
+	return result;
+}
@@ -0,0 +1,156 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+/* Build of the library without exceptions nor RTTI, and what it saves.
+ * The test suites need exceptions (mettle reports failures with them), so a program using every part of the library,
+ * and checking the results itself, is generated instead. It is compiled with -O2, with exceptions and RTTI, then with
+ * -fno-exceptions -fno-rtti, and both builds are run. The sizes of both stripped executables are reported.
+ * The compiler is taken from the CXX environment variable (c++ by default), and the include folder of the library
+ * can be given as first argument (include, from the root of the repository, by default).
+ */
+
+namespace
+{
+
+const char* source = R"(#include <array>
+#include <cstdio>
+#include <vector>
+#include <EnumScanner.hxx>
+#include <EnumSerialization.hxx>
+#include <FixedStringMap.hxx>
+#include <ImprovedEnum.hxx>
+#include <RangeChunks.hxx>
+#include <RangeViews.hxx>
+#include <StaticRing.hxx>
+#include <StaticString.hxx>
+#include <StaticVector.hxx>
+#include <StringPool.hxx>
+#include <StringSplit.hxx>
+
+IMPROVED_ENUM(Level, uint16_t, Debug, Info, Warning = 10, Error, Fatal);
+
+static int failures = 0;
+
+static void check(bool condition, const char* what)
+{
+	if(!condition)
+	{
+		std::printf("Check failed : %s\n", what);
+		++failures;
+	}
+}
+
+int main(int argc, char**)
+{
+	const ConstString line = argc > 5 ? ConstString{""} : ConstString{"Info;Error,Fatal;Trace"};
+	StaticVector<Level, 8> levels;
+	for(ConstString field : tokenize(line, ",;"))
+	{
+		if(const auto level = Level::try_from_string(field))
+		{
+			levels.push_back(*level);
+		}
+	}
+	check(levels.size() == 3, "tokenize and try_from_string");
+	check(!Level::try_from_value(3), "try_from_value");
+	check(Level::from_value(11) == Level::Error, "from_value");
+	check(line.drop(5) == ConstString{"Error,Fatal;Trace"}, "drop");
+	check(!line.try_drop(100), "try_drop");
+
+	StaticString<64> text;
+	for(auto level : Level::iter() | views::filter([](Level l) { return l >= Level::Warning; }))
+	{
+		text.append(level.to_string()).append(' ');
+	}
+	check(text == ConstString{"Warning Error Fatal "}, "views and append");
+
+	StaticRing<Level, 2> last;
+	for(Level level : levels)
+	{
+		last.push_back<RingOverflowPolicy::Overwrite>(level);
+	}
+	check(last.front() == Level::Error, "ring");
+
+	const std::array<Level, 3> encoded{levels[0], levels[1], levels[2]};
+	std::array<std::byte, 6> buffer{};
+	EnumUtils::encode<Endianess::big>(encoded, buffer.data());
+	std::array<Level, 3> decoded{};
+	check(EnumUtils::decode<Endianess::big>(buffer.data(), decoded) == 3 && decoded[2] == Level::Fatal, "serialization");
+
+	FixedStringMap<16, int> counts;
+	EnumUtils::Scanner<Level> scanner;
+	scanner.scan(line, [&](size_t, Level level) { ++counts.try_emplace(level.to_string(), 0).first.value(); });
+	check(counts.find("Error") != counts.end(), "scanner and map");
+
+	StringPool pool;
+	check(pool.intern("Info") == pool.intern(Level{Level::Info}.to_string()), "pool");
+
+	std::vector<int> values(1000, 1);
+	int sum = 0;
+	for(auto part : values | views::partitions(4))
+	{
+		const auto blocks = part | views::chunks<8>();
+		for(auto block : blocks)
+		{
+			for(int value : block)
+			{
+				sum += value;
+			}
+		}
+		for(int value : blocks.remainder())
+		{
+			sum += value;
+		}
+	}
+	check(sum == 1000, "chunks");
+
+	std::printf("%s\n", failures == 0 ? "All checks passed" : "Some checks failed");
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+)";
+
+// Size of the executable built with the given flags, or 0 if it does not build or does not pass its checks.
+uintmax_t buildAndRun(const char* compiler, const std::string& includeDir, const std::string& flags)
+{
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourcePath = directory / "NoExceptions.cxx";
+	const auto programPath = directory / "NoExceptions";
+	std::ofstream{sourcePath} << source;
+
+	const std::string command = std::string{compiler} + " -std=c++20 -O2 -s " + flags + " -I" + includeDir + " "
+							  + sourcePath.string() + " -o " + programPath.string() + " -lpthread";
+	uintmax_t size = 0;
+	if(std::system(command.c_str()) == 0 && std::system(programPath.string().c_str()) == 0)
+	{
+		size = std::filesystem::file_size(programPath);
+	}
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(programPath);
+	return size;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+
+	std::printf("Compiler : %s\n", compiler);
+	std::fflush(stdout);
+	const uintmax_t withExceptions = buildAndRun(compiler, includeDir, "-w");
+	const uintmax_t withoutExceptions = buildAndRun(compiler, includeDir, "-w -fno-exceptions -fno-rtti");
+	if(withExceptions == 0 || withoutExceptions == 0)
+	{
+		std::printf("The build %s exceptions failed\n", withExceptions == 0 ? "with" : "without");
+		return EXIT_FAILURE;
+	}
+
+	std::printf("%-40s %10ju bytes\n", "With exceptions and RTTI", withExceptions);
+	std::printf("%-40s %10ju bytes (%.1f%% smaller)\n", "With -fno-exceptions -fno-rtti", withoutExceptions,
+				100.0 * (static_cast<double>(withExceptions) - static_cast<double>(withoutExceptions)) / static_cast<double>(withExceptions));
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Benchmark.hxx"
+
+/* Compile-time cost of building large StaticString in constant expressions.
+ * For each size, a translation unit declaring constexpr StaticString from a literal and from a ConstString range
+ * is generated, then only type checked by the compiler (-fsyntax-only), which is where the constant evaluation
+ * happens. The compiler is taken from the CXX environment variable (c++ by default), and the include folder of
+ * the library can be given as first argument (include, from the root of the repository, by default).
+ */
+
+namespace
+{
+
+std::string makeSource(size_t size)
+{
+	std::string literal(size, 'a');
+	for(size_t i = 0; i < size; ++i)
+	{
+		literal[i] = static_cast<char>('a' + i % 26);
+	}
+
+	std::string source = "#include <StaticString.hxx>\n";
+	source += "constexpr char text[] = \"" + literal + "\";\n";
+	source += "constexpr StaticString<" + std::to_string(size) + "> fromLiteral{text};\n";
+	source += "constexpr ConstString view{text};\n";
+	source += "constexpr StaticString<" + std::to_string(size) + "> fromRange{range<ConstString::const_iterator>{view.begin(), view.end()}};\n";
+	source += "static_assert(fromLiteral.size() == " + std::to_string(size) + ", \"\");\n";
+	source += "static_assert(fromLiteral == ConstString{fromRange}, \"\");\n";
+	source += "static_assert(fromRange[" + std::to_string(size - 1) + "] == '" + literal.back() + "', \"\");\n";
+	return source;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const char* compiler = std::getenv("CXX") ? std::getenv("CXX") : "c++";
+	const std::string includeDir = argc > 1 ? argv[1] : "include";
+	const auto directory = std::filesystem::temp_directory_path();
+
+	std::printf("Compiler : %s\n", compiler);
+	for(size_t size : {size_t{1024}, size_t{65536}})
+	{
+		const auto path = directory / ("StaticStringCompile" + std::to_string(size) + ".cxx");
+		std::ofstream{path} << makeSource(size);
+
+		const std::string command = std::string{compiler} + " -std=c++20 -fsyntax-only -w -fconstexpr-ops-limit=4294967296 -I" + includeDir + " " + path.string();
+		int status = 0;
+		double seconds = Bench::bestSeconds([&]() { status = std::system(command.c_str()); }, 3);
+		std::filesystem::remove(path);
+
+		if(status != 0)
+		{
+			std::printf("Compilation of the %zu characters strings failed\n", size);
+			return EXIT_FAILURE;
+		}
+		std::printf("%-40s %10zu chars %10.3f ms\n", "StaticString constexpr construction", size, seconds * 1e3);
+	}
+	return EXIT_SUCCESS;
+}
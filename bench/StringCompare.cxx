@@ -0,0 +1,109 @@
+#include <compare>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <ConstString.hxx>
+
+#include "Benchmark.hxx"
+
+namespace
+{
+
+// The character loops used before the runtime dispatch, as reference.
+bool scalarEqual(ConstString lhs, ConstString rhs)
+{
+	if(lhs.size() != rhs.size())
+	{
+		return false;
+	}
+	for(size_t i = 0; i < lhs.size(); ++i)
+	{
+		if(lhs[i] != rhs[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+ConstString::const_iterator scalarFind(const ConstString& str, char c)
+{
+	for(auto it = str.begin(); it != str.end(); ++it)
+	{
+		if(*it == c)
+		{
+			return it;
+		}
+	}
+	return str.end();
+}
+
+struct Dataset
+{
+	// Two identical copies, so that comparisons have to go through every byte.
+	std::string left;
+	std::string right;
+	size_t stringSize;
+	size_t count;
+
+	ConstString leftAt(size_t i) const { return std::string_view{left.data() + i * stringSize, stringSize}; }
+	ConstString rightAt(size_t i) const { return std::string_view{right.data() + i * stringSize, stringSize}; }
+};
+
+Dataset makeDataset(size_t stringSize, size_t totalSize)
+{
+	Dataset dataset{{}, {}, stringSize, totalSize / stringSize};
+	dataset.left.resize(dataset.count * stringSize);
+	for(size_t i = 0; i < dataset.left.size(); ++i)
+	{
+		// No '#' anywhere except at the end of each string, where find() stops.
+		dataset.left[i] = (i + 1) % stringSize == 0 ? '#' : static_cast<char>('a' + (i * 7) % 26);
+	}
+	dataset.right = dataset.left;
+	return dataset;
+}
+
+void benchSize(const char* label, size_t stringSize)
+{
+	constexpr size_t totalSize = 32 * 1024 * 1024;
+	const Dataset dataset = makeDataset(stringSize, totalSize);
+	const size_t bytes = dataset.count * stringSize;
+	char name[64];
+
+	auto run = [&](const char* operation, auto&& fn) {
+		size_t result = 0;
+		double seconds = Bench::bestSeconds([&]() {
+			result = 0;
+			for(size_t i = 0; i < dataset.count; ++i)
+			{
+				result += fn(dataset.leftAt(i), dataset.rightAt(i));
+			}
+			Bench::doNotOptimize(result);
+		});
+		std::snprintf(name, sizeof(name), "%s %s", operation, label);
+		Bench::reportThroughput(name, bytes, seconds);
+		return result;
+	};
+
+	const size_t equal = run("operator==", [](ConstString lhs, ConstString rhs) { return lhs == rhs ? 1 : 0; });
+	const size_t scalarEqualCount = run("scalar equal", [](ConstString lhs, ConstString rhs) { return scalarEqual(lhs, rhs) ? 1 : 0; });
+	run("operator<=>", [](ConstString lhs, ConstString rhs) { return (lhs <=> rhs) == 0 ? 1 : 0; });
+	const size_t found = run("find", [](ConstString lhs, ConstString) { return static_cast<size_t>(lhs.find('#') - lhs.begin()); });
+	const size_t scalarFound = run("scalar find", [](ConstString lhs, ConstString) { return static_cast<size_t>(scalarFind(lhs, '#') - lhs.begin()); });
+
+	if(equal != scalarEqualCount || found != scalarFound)
+	{
+		std::printf("Mismatch between the runtime and scalar results for %s strings\n", label);
+	}
+}
+
+}
+
+int main()
+{
+	benchSize("(8B)", 8);
+	benchSize("(64B)", 64);
+	benchSize("(4KiB)", 4096);
+	return 0;
+}
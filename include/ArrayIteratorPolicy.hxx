@@ -2,14 +2,27 @@
 #define ARRAY_ITERATOR_POLICY_HXX
 
 #include <cstddef>
+#include <iterator>
+#include <type_traits>
 
 #include <ConstexprAssert.hxx>
 #include <Platform.hxx>
 
+/* With ARRAY_ITERATOR_CHECKED, the default iterators keep a reference to their array and an index, so that comparing
+ * iterators of different arrays can be detected. Otherwise, they are plain pointers : the standard algorithms then
+ * recognize them, lowering std::copy to memmove, and so on, which they do not for a class wrapping a pointer.
+ * The iterators change the type returned by the inline members of every array-like class, so they are not checked
+ * unless asked for, whatever NDEBUG : a program must define ARRAY_ITERATOR_CHECKED the same way in all its
+ * translation units. The unchecked iterators are always the pointers.
+ */
+#ifndef ARRAY_ITERATOR_CHECKED
+#define ARRAY_ITERATOR_CHECKED 0
+#endif
+
 /* Define an helper class to ease defining array style class iterators.
  * To take full advantage of this code, the array-like class should have an overloaded operator[],
  * and a data() function, in order to allow forced unchecked iterator, which may be useful when using
- * constexpr.
+ * constexpr. It must declare its value_type before naming the iterators of the policy.
  */
 
 /* There's a warning about "multiple copy constructor specified", due to partial visual studio
@@ -33,41 +46,38 @@ class ArrayIteratorPolicy
 {
 protected:
 	template<bool constFlag>
-	class BaseIterator : public std::iterator<std::random_access_iterator_tag, typename ArrayClass::value_type>
+	class BaseIterator
 	{
 		friend BaseIterator<!constFlag>;
 		//friend ArrayClass;
 	protected:
 		using IndexType = size_t;
 		using ArrayClassRef = typename std::conditional<constFlag, const typename std::remove_cv<ArrayClass>::type&, typename std::remove_cv<ArrayClass>::type&>::type;
+		using ArrayClassPtr = typename std::remove_reference<ArrayClassRef>::type*;
 	public:
+		using iterator_category = std::random_access_iterator_tag;
 		using value_type = typename ArrayClass::value_type;
 		using reference = typename std::conditional<constFlag, const typename std::remove_cv<value_type>::type&, value_type&>::type;
 		using pointer = typename std::conditional<constFlag, const typename std::remove_cv<value_type>::type*, value_type*>::type;
 		using difference = ptrdiff_t;
+		using difference_type = ptrdiff_t;
 		
 	protected:
-		constexpr BaseIterator(ArrayClassRef rhs, IndexType index) : it_(rhs), index_(index) {}
+		constexpr BaseIterator(ArrayClassRef rhs, IndexType index) : array_(&rhs), index_(index) {}
 
 	public:
-		constexpr BaseIterator() = delete;
-		constexpr BaseIterator(const BaseIterator& other) : it_(other.it_),
+		// A default constructed iterator is singular : it can only be assigned to.
+		constexpr BaseIterator() noexcept : array_(nullptr), index_(0) {}
+		constexpr BaseIterator(const BaseIterator& other) : array_(other.array_),
 															index_(other.index_)
 		{}
 		template<bool TconstFlag = constFlag,
 				 typename std::enable_if<TconstFlag == true, bool>::type = false>
-		constexpr BaseIterator(const BaseIterator<false>& other) : it_(other.it_),
+		constexpr BaseIterator(const BaseIterator<false>& other) : array_(other.array_),
 																	   index_(other.index_)
 		{}
 		
-		constexpr BaseIterator& operator=(const BaseIterator& other)
-		{
-			CONSTEXPR_ASSERT(hasSameArray(other), "The other iterator do not iterate on the same array as this iterator");
-			
-			index_ = other.index_;
-			
-			return *this;
-		}
+		constexpr BaseIterator& operator=(const BaseIterator& other) = default;
 
 		template<bool TconstFlag>
 		constexpr bool operator==(const BaseIterator<TconstFlag>& rhs) const noexcept { return (hasSameIndex(rhs) && hasSameArray(rhs)); }
@@ -76,7 +86,7 @@ protected:
 
 		constexpr operator BaseIterator<true>() const noexcept
 		{
-			return{ it_, index_ };
+			return{ *array_, index_ };
 		}
 		
 		template<bool otherConstFlag>
@@ -100,11 +110,11 @@ protected:
 		template<bool otherConstFlag>
 		constexpr bool hasSameArray(const BaseIterator<otherConstFlag>& other) const noexcept
 		{
-			return &it_ == &other.it_;
+			return array_ == other.array_;
 		}
 		
 	protected:
-		ArrayClassRef it_;
+		ArrayClassPtr array_;
 		IndexType index_;
 	};
 
@@ -125,6 +135,7 @@ protected:
 		
 		private:
 		friend ArrayClass;
+		friend ArrayIteratorPolicy;
 		using Base::Base;
 
 		public:
@@ -137,6 +148,7 @@ protected:
 		template<bool otherConstFlag>
 		constexpr difference operator-(const Iterator<otherConstFlag>& rhs) const noexcept
 		{
+			CONSTEXPR_ASSERT(this->hasSameArray(rhs), "The iterators do not iterate on the same array");
 			return this->index_ - rhs.index_;
 		}
 		
@@ -168,13 +180,13 @@ protected:
 		
 		constexpr Iterator operator+(size_t n) const noexcept
 		{
-			Iterator tmp{ this->it_, this->index_ + n};
+			Iterator tmp{ *this->array_, this->index_ + n};
 			return tmp;
 		}
 		
 		constexpr Iterator operator-(size_t n) const noexcept
 		{
-			Iterator tmp{ this->it_, this->index_ - n};
+			Iterator tmp{ *this->array_, this->index_ - n};
 			return tmp;
 		}
 		
@@ -190,22 +202,23 @@ protected:
 			return *this;
 		}
 		
-		constexpr reference operator*()
-		{ 
-			return this->it_[this->index_]; 
+		// The constness of an iterator is not the one of the elements it refers to.
+		constexpr reference operator*() const
+		{
+			return (*this->array_)[this->index_];
+		}
+		constexpr pointer operator->() const
+		{
+			return &((*this->array_)[this->index_]);
 		}
-		constexpr pointer operator->()
-		{ 
-			return &(this->it_[this->index_]); 
+		constexpr reference operator[](difference n) const
+		{
+			return (*this->array_)[this->index_ + n];
 		}
 		
-		constexpr const auto& operator*() const 
-		{ 
-			return this->it_[this->index_]; 
-		}
-		constexpr const auto* operator->() const 
-		{ 
-			return &(this->it_[this->index_]); 
+		friend constexpr Iterator operator+(difference n, const Iterator& it) noexcept
+		{
+			return it + n;
 		}
 		
 		template<bool otherConstFlag> 
@@ -230,7 +243,7 @@ protected:
 		}
 		
 		template<bool otherConstFlag> 
-		constexpr bool operator>=(const Iterator<otherConstFlag>& rhs) noexcept
+		constexpr bool operator>=(const Iterator<otherConstFlag>& rhs) const noexcept
 		{
 			return this->hasSameArray(rhs) 
 				&& !this->hasSmallerIndex(rhs);
@@ -270,7 +283,8 @@ protected:
 		template<bool otherConstFlag>
 		constexpr difference operator-(const ReverseIterator<otherConstFlag>& rhs) const noexcept
 		{
-			return this->index_ - rhs.index_;
+			CONSTEXPR_ASSERT(this->hasSameArray(rhs), "The iterators do not iterate on the same array");
+			return rhs.index_ - this->index_;
 		}
 		
 		constexpr ReverseIterator& operator++() noexcept
@@ -301,45 +315,46 @@ protected:
 		
 		constexpr ReverseIterator operator+(size_t n) const noexcept
 		{
-			ReverseIterator tmp{ this->it_, this->index_ - n };
+			ReverseIterator tmp{ *this->array_, this->index_ - n };
 			return tmp;
 		}
 		
 		constexpr ReverseIterator operator-(size_t n) const noexcept
 		{
-			ReverseIterator tmp{ this->it_, this->index_ + n };
+			ReverseIterator tmp{ *this->array_, this->index_ + n };
 			return tmp;
 		}
 		
 		constexpr ReverseIterator& operator+=(size_t n)
 		{
-			*this = *this - n;
+			*this = *this + n;
 			return *this;
 		}
 		
 		constexpr ReverseIterator& operator-=(size_t n)
 		{
-			*this = *this + n;
+			*this = *this - n;
 			return *this;
 		}
 		
-		constexpr reference operator*()
-		{ 
-			return this->it_[this->index_ - 1]; 
+		// The constness of an iterator is not the one of the elements it refers to.
+		constexpr reference operator*() const
+		{
+			return (*this->array_)[this->index_ - 1];
 		}
-		constexpr pointer operator->()
+		constexpr pointer operator->() const
 		{
-			return &(this->it_[this->index_ - 1]);
-		}	
-		
-		constexpr const auto& operator*() const
-		{ 
-			return this->it_[this->index_ - 1]; 
+			return &((*this->array_)[this->index_ - 1]);
+		}
+		constexpr reference operator[](difference n) const
+		{
+			return (*this->array_)[this->index_ - n - 1];
 		}
-		constexpr const auto* operator->() const
+		
+		friend constexpr ReverseIterator operator+(difference n, const ReverseIterator& it) noexcept
 		{
-			return &(this->it_[this->index_ - 1]);
-		}	
+			return it + n;
+		}
 		
 		template<bool otherConstFlag>
 		constexpr bool operator<(const ReverseIterator<otherConstFlag>& rhs) const noexcept
@@ -349,83 +364,71 @@ protected:
 		}
 		
 		template<bool otherConstFlag>
-		constexpr bool operator<=(const ReverseIterator<otherConstFlag>& rhs) noexcept
+		constexpr bool operator<=(const ReverseIterator<otherConstFlag>& rhs) const noexcept
 		{
 			return this->hasSameArray(rhs) 
 				&& !this->hasSmallerIndex(rhs);
 		}
 		
 		template<bool otherConstFlag>
-		constexpr bool operator>(const ReverseIterator<otherConstFlag>& rhs) noexcept
+		constexpr bool operator>(const ReverseIterator<otherConstFlag>& rhs) const noexcept
 		{
 			return this->hasSameArray(rhs) 
 				&& this->hasSmallerIndex(rhs);
 		}
 		
 		template<bool otherConstFlag>
-		constexpr bool operator>=(const ReverseIterator<otherConstFlag>& rhs) noexcept
+		constexpr bool operator>=(const ReverseIterator<otherConstFlag>& rhs) const noexcept
 		{
 			return this->hasSameArray(rhs) 
 				&& !this->hasGreaterIndex(rhs);
 		}
 	};
 	
-	template<bool constFlag>
-	class UncheckedIterator : public Iterator<constFlag>
-	{
-		using Base = Iterator<constFlag>;
+public:
+	// Index based iterators, for the array-like classes whose elements are not contiguous.
+	using indexed_iterator = Iterator<false>;
+	using indexed_reverse_iterator = ReverseIterator<false>;
+	using indexed_const_iterator = Iterator<true>;
+	using indexed_const_reverse_iterator = ReverseIterator<true>;
 
-		public:
-		using value_type = typename Base::value_type;
-		using reference = typename Base::reference;
-		using pointer = typename Base::pointer;
-		
-		using Base::Base;
-		
-		constexpr typename std::remove_cv<value_type>::type operator*() const noexcept
-		{
-			return *(this->operator->());
-		}
-		
-		constexpr pointer operator->() const noexcept
-		{
-			return this->it_.data() + this->index_;
-		}
-	};
-	
-	template<bool constFlag>
-	class UncheckedReverseIterator : public ReverseIterator<constFlag>
-	{	
-		using Base = ReverseIterator<constFlag>;
-		
-		public:
-		using value_type = typename Base::value_type;
-		using reference = typename Base::reference;
-		using pointer = typename Base::pointer;
-		
-		using Base::Base;
-		
-		constexpr typename std::remove_cv<value_type>::type operator*() const noexcept
-		{
-			return *(this->operator->());
-		}
-		
-		constexpr pointer operator->() const noexcept
-		{
-			return this->it_.data() + this->index_;
-		}
-	};
+	// Plain pointers, which the standard library sees through.
+	using unchecked_iterator = typename std::remove_cv<typename ArrayClass::value_type>::type*;
+	using unchecked_reverse_iterator = std::reverse_iterator<unchecked_iterator>;
+	using unchecked_const_iterator = const typename std::remove_cv<typename ArrayClass::value_type>::type*;
+	using unchecked_const_reverse_iterator = std::reverse_iterator<unchecked_const_iterator>;
 
-public:
+#if ARRAY_ITERATOR_CHECKED
 	using iterator = Iterator<false>;
 	using reverse_iterator = ReverseIterator<false>;
 	using const_iterator = Iterator<true>;
 	using const_reverse_iterator = ReverseIterator<true>;
-	
-	using unchecked_iterator = UncheckedIterator<false>;
-	using unchecked_reverse_iterator = UncheckedReverseIterator<false>;
-	using unchecked_const_iterator = UncheckedIterator<true>;
-	using unchecked_const_reverse_iterator = UncheckedReverseIterator<true>;
+#else
+	using iterator = unchecked_iterator;
+	using reverse_iterator = unchecked_reverse_iterator;
+	using const_iterator = unchecked_const_iterator;
+	using const_reverse_iterator = unchecked_const_reverse_iterator;
+#endif
+
+	// The iterator on the element of the given index, so that the array-like classes build them the same way whatever
+	// their kind. The array must have a data() function when the iterators are not checked.
+	static constexpr iterator makeIterator(ArrayClass& array, size_t index) noexcept
+	{
+#if ARRAY_ITERATOR_CHECKED
+		return { array, index };
+#else
+		return array.data() + index;
+#endif
+	}
+
+	static constexpr const_iterator makeIterator(const ArrayClass& array, size_t index) noexcept
+	{
+#if ARRAY_ITERATOR_CHECKED
+		return { array, index };
+#else
+		return array.data() + index;
+#endif
+	}
 };
 
 #if(COMPILER == MVSC_COMPILER)
@@ -0,0 +1,168 @@
+#ifndef ASCII_CASE_HXX
+#define ASCII_CASE_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <ConstString.hxx>
+#include <CpuFeatures.hxx>
+#include <Platform.hxx>
+#include <StringDetails.hxx>
+
+// SSE2 is part of x86-64, while AVX2 is compiled when the build targets it, or else selected at runtime.
+#if defined(__AVX2__) || CPU_DISPATCH
+#define ASCII_CASE_AVX2 1
+#else
+#define ASCII_CASE_AVX2 0
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#define ASCII_CASE_SSE2 1
+#else
+#define ASCII_CASE_SSE2 0
+#endif
+
+#if ASCII_CASE_AVX2 || ASCII_CASE_SSE2
+#include <immintrin.h>
+#endif
+
+/* ASCII case folding helpers, used for case insensitive name lookups.
+ * Only 'A' to 'Z' are folded, every other byte (including non ASCII ones) is compared as is.
+ * Nothing is ever copied : the bytes are folded on the fly, eight at a time in a word for hashing, and
+ * by blocks of 16 (SSE2) or 32 (AVX2, when the machine supports it, see CpuFeatures.hxx) bytes for comparisons.
+ * The scalar versions are used at compile time.
+ */
+
+namespace Details
+{
+
+constexpr char foldCase(char c) noexcept
+{
+	return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+// Fold the eight bytes of a word at once (SWAR).
+constexpr uint64_t foldCaseWord(uint64_t word) noexcept
+{
+	constexpr uint64_t ones = 0x0101010101010101ull;
+	constexpr uint64_t highBits = 0x8080808080808080ull;
+
+	const uint64_t low = word & ~highBits;
+	const uint64_t aboveA = low + ones * (0x80 - 'A');
+	const uint64_t aboveZ = low + ones * (0x80 - 'Z' - 1);
+	const uint64_t upper = aboveA & ~aboveZ & ~word & highBits;
+
+	return word | (upper >> 2);
+}
+
+constexpr uint64_t hashIgnoreCase(ConstString str) noexcept
+{
+	constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	const char* data = str.data();
+	const size_t size = str.size();
+	uint64_t hash = size * multiplier;
+
+	size_t i = 0;
+	for(; i + 8 <= size; i += 8)
+	{
+		hash = (hash ^ foldCaseWord(loadWord(data + i))) * multiplier;
+		hash ^= hash >> 32;
+	}
+	if(i != size)
+	{
+		hash = (hash ^ foldCaseWord(loadWord(data + i, size - i))) * multiplier;
+		hash ^= hash >> 32;
+	}
+	return hash;
+}
+
+// The vector kernels compare the blocks from index i, stopping before the last partial one, and tell whether they are
+// equal ignoring case. The AVX2 one is only to be called when the machine supports it.
+#if ASCII_CASE_AVX2
+target_feature("avx2") inline __m256i foldCaseAvx2(const char* data) noexcept
+{
+	const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+	const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), bytes));
+	return _mm256_or_si256(bytes, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+target_feature("avx2") inline bool equalBlocksIgnoreCaseAvx2(const char* left, const char* right, size_t size, size_t& i) noexcept
+{
+	for(; i + 32 <= size; i += 32)
+	{
+		const __m256i l = foldCaseAvx2(left + i);
+		const __m256i r = foldCaseAvx2(right + i);
+		if(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r))) != 0xFFFFFFFFu)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+#endif
+
+#if ASCII_CASE_SSE2
+inline __m128i foldCaseSse2(const char* data) noexcept
+{
+	const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+	const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), bytes));
+	return _mm_or_si128(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+inline bool equalBlocksIgnoreCaseSse2(const char* left, const char* right, size_t size, size_t& i) noexcept
+{
+	for(; i + 16 <= size; i += 16)
+	{
+		const __m128i l = foldCaseSse2(left + i);
+		const __m128i r = foldCaseSse2(right + i);
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(l, r)) != 0xFFFF)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+#endif
+
+constexpr bool equalIgnoreCase(ConstString lhs, ConstString rhs) noexcept
+{
+	if(lhs.size() != rhs.size())
+	{
+		return false;
+	}
+
+	const char* left = lhs.data();
+	const char* right = rhs.data();
+	const size_t size = lhs.size();
+	size_t i = 0;
+
+	if(!std::is_constant_evaluated())
+	{
+#if ASCII_CASE_AVX2
+		if(supportsAvx2() && !equalBlocksIgnoreCaseAvx2(left, right, size, i))
+		{
+			return false;
+		}
+#endif
+#if ASCII_CASE_SSE2
+		// After the AVX2 blocks, what is left may still hold a block of 16 bytes.
+		if(!equalBlocksIgnoreCaseSse2(left, right, size, i))
+		{
+			return false;
+		}
+#endif
+	}
+
+	for(; i + 8 <= size; i += 8)
+	{
+		if(foldCaseWord(loadWord(left + i)) != foldCaseWord(loadWord(right + i)))
+		{
+			return false;
+		}
+	}
+	return foldCaseWord(loadWord(left + i, size - i)) == foldCaseWord(loadWord(right + i, size - i));
+}
+}
+
+#endif // ASCII_CASE_HXX
@@ -0,0 +1,176 @@
+#ifndef BYTE_SET_HXX
+#define BYTE_SET_HXX
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <ConstString.hxx>
+#include <CpuFeatures.hxx>
+#include <Platform.hxx>
+#include <RangeChunks.hxx>
+
+// The vector kernels are compiled when the build targets their instruction set, or else selected at runtime.
+#if defined(__AVX2__) || CPU_DISPATCH
+#define BYTE_SET_AVX2 1
+#else
+#define BYTE_SET_AVX2 0
+#endif
+#if defined(__SSSE3__) || CPU_DISPATCH
+#define BYTE_SET_SSSE3 1
+#else
+#define BYTE_SET_SSSE3 0
+#endif
+
+#if BYTE_SET_AVX2 || BYTE_SET_SSSE3
+#include <immintrin.h>
+#endif
+
+/* Set of bytes, able to find the first byte of a buffer belonging to the set.
+ * At runtime the search tests 16 (SSSE3) or 32 (AVX2) bytes at once, the widest set supported by the machine being
+ * chosen when the build does not target it (see CpuFeatures.hxx), with the usual nibble lookup trick :
+ * bytes are sorted in 8 buckets by high nibble, and a byte is a candidate if its low and high nibbles share
+ * a bucket. High nibbles sharing a bucket (h and h + 8) may give false positives, so candidates are
+ * confirmed with the plain membership table, which is also all that is used at compile time.
+ */
+
+namespace Details
+{
+
+class ByteSet
+{
+public:
+	constexpr ByteSet() noexcept : members_{}, lowNibbles_{}, highNibbles_{}
+	{}
+
+	constexpr explicit ByteSet(ConstString bytes) noexcept : ByteSet{}
+	{
+		for(size_t i = 0; i < bytes.size(); ++i)
+		{
+			insert(bytes.data()[i]);
+		}
+	}
+
+	constexpr void insert(char c) noexcept
+	{
+		const auto byte = static_cast<unsigned char>(c);
+		const uint8_t bucket = static_cast<uint8_t>(1u << ((byte >> 4) % 8));
+
+		members_[byte] = 1;
+		lowNibbles_[byte & 0xF] |= bucket;
+		highNibbles_[byte >> 4] = bucket;
+	}
+
+	constexpr bool contains(char c) const noexcept
+	{
+		return members_[static_cast<unsigned char>(c)] != 0;
+	}
+
+	// Index of the first byte of [data, data + size) belonging to the set, or size.
+	constexpr size_t findFirstOf(const char* data, size_t size) const noexcept
+	{
+		if(!std::is_constant_evaluated())
+		{
+#if defined(__AVX2__)
+			return findFirstOfAvx2(data, size);
+#else
+#if BYTE_SET_AVX2
+			if(cpuFeatures().avx2)
+			{
+				return findFirstOfAvx2(data, size);
+			}
+#endif
+#if defined(__SSSE3__)
+			return findFirstOfSsse3(data, size);
+#elif BYTE_SET_SSSE3
+			if(cpuFeatures().ssse3)
+			{
+				return findFirstOfSsse3(data, size);
+			}
+#endif
+#endif
+		}
+		return findFirstOfFrom(data, 0, size);
+	}
+
+	// The same search from index, a byte at a time.
+	constexpr size_t findFirstOfFrom(const char* data, size_t index, size_t size) const noexcept
+	{
+		for(; index < size; ++index)
+		{
+			if(contains(data[index]))
+			{
+				return index;
+			}
+		}
+		return size;
+	}
+
+	// The vector kernels, only to be called when the machine supports their instruction set.
+#if BYTE_SET_AVX2
+	target_feature("avx2") size_t findFirstOfAvx2(const char* data, size_t size) const noexcept
+	{
+		const __m256i lowTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lowNibbles_.data())));
+		const __m256i highTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(highNibbles_.data())));
+		const __m256i nibbleMask = _mm256_set1_epi8(0xF);
+
+		const auto blocks = range<const char*>{data, data + size} | views::chunks<32>();
+		for(std::span<const char, 32> block : blocks)
+		{
+			const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.data()));
+			const __m256i low = _mm256_shuffle_epi8(lowTable, _mm256_and_si256(bytes, nibbleMask));
+			const __m256i high = _mm256_shuffle_epi8(highTable, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask));
+			const __m256i misses = _mm256_cmpeq_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256());
+
+			for(uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(misses)); mask != 0; mask &= mask - 1)
+			{
+				const size_t index = static_cast<size_t>(block.data() - data) + std::countr_zero(mask);
+				if(contains(data[index]))
+				{
+					return index;
+				}
+			}
+		}
+		return findFirstOfFrom(data, static_cast<size_t>(blocks.remainder().data() - data), size);
+	}
+#endif
+
+#if BYTE_SET_SSSE3
+	target_feature("ssse3") size_t findFirstOfSsse3(const char* data, size_t size) const noexcept
+	{
+		const __m128i lowTable = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lowNibbles_.data()));
+		const __m128i highTable = _mm_loadu_si128(reinterpret_cast<const __m128i*>(highNibbles_.data()));
+		const __m128i nibbleMask = _mm_set1_epi8(0xF);
+
+		const auto blocks = range<const char*>{data, data + size} | views::chunks<16>();
+		for(std::span<const char, 16> block : blocks)
+		{
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data()));
+			const __m128i low = _mm_shuffle_epi8(lowTable, _mm_and_si128(bytes, nibbleMask));
+			const __m128i high = _mm_shuffle_epi8(highTable, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+			const __m128i misses = _mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128());
+
+			for(uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(misses)) & 0xFFFF; mask != 0; mask &= mask - 1)
+			{
+				const size_t index = static_cast<size_t>(block.data() - data) + std::countr_zero(mask);
+				if(contains(data[index]))
+				{
+					return index;
+				}
+			}
+		}
+		return findFirstOfFrom(data, static_cast<size_t>(blocks.remainder().data() - data), size);
+	}
+#endif
+
+private:
+	std::array<uint8_t, 256> members_;
+	std::array<uint8_t, 16> lowNibbles_;
+	std::array<uint8_t, 16> highNibbles_;
+};
+
+}
+
+#endif // BYTE_SET_HXX
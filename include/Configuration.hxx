@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <cstdint>
 
 #include <Platform.hxx>
@@ -21,3 +22,6 @@ enum class Endianess : flag_type
 	big
 };
 
+// Byte order of the machine the code is compiled for.
+inline constexpr Endianess nativeEndianess = std::endian::native == std::endian::big ? Endianess::big : Endianess::little;
+
@@ -4,12 +4,15 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <compare>
 #include <cstddef>
+#include <optional>
 #include <stdexcept>
 
 #include <gsl/gsl_assert.h>
 
 #include <ArrayIteratorPolicy.hxx>
+#include <ConstexprAssert.hxx>
 #include <MetaUtils.hxx>
 #include <Range.hxx>
 #include <Platform.hxx>
@@ -25,15 +28,15 @@ class ConstString
 	using IterPolicy = ArrayIteratorPolicy<ConstString>;
 	
 public:	
+	using value_type = const char;
+	using reference = const char&;
+	using pointer = const char*;
+	
 	using iterator = typename IterPolicy::const_iterator;
 	using reverse_iterator = typename IterPolicy::const_reverse_iterator;
 	using const_iterator = typename IterPolicy::const_iterator;
 	using const_reverse_iterator = typename IterPolicy::const_reverse_iterator;
 	
-	using value_type = const char;
-	using reference = const char&;
-	using pointer = const char*;
-	
 public:
 	// Serve for the sole purpose of begin able to be literal type even with default constructor
 	ConstString() = default;
@@ -47,23 +50,26 @@ public:
 	constexpr ConstString(const TString& other) noexcept : size_(other.size()), cstr_(other.data())
 	{}
 	
-	constexpr iterator begin() noexcept { return { *this, 0 }; }
-	constexpr const_iterator begin() const noexcept { return { *this, 0 }; }
+	constexpr ConstString(const char* data, size_t size) noexcept : size_(size), cstr_(data)
+	{}
+	
+	constexpr iterator begin() noexcept { return cbegin(); }
+	constexpr const_iterator begin() const noexcept { return IterPolicy::makeIterator(*this, 0); }
 	constexpr const_iterator cbegin() const noexcept { return begin(); }
-	constexpr iterator end() noexcept { return { *this, size() }; }
-	constexpr const_iterator end() const noexcept { return { *this, size() }; }
+	constexpr iterator end() noexcept { return cend(); }
+	constexpr const_iterator end() const noexcept { return IterPolicy::makeIterator(*this, size()); }
 	constexpr const_iterator cend() const noexcept { return end(); }
 
-	constexpr reverse_iterator rbegin() noexcept { return end(); }
-	constexpr const_reverse_iterator rbegin() const noexcept { return end(); }
-	constexpr const_reverse_iterator crbegin() const noexcept { return end(); }
-	constexpr reverse_iterator rend() noexcept { return begin(); }
-	constexpr const_reverse_iterator rend() const noexcept { return begin(); }
-	constexpr const_reverse_iterator crend() const noexcept { return begin(); }
+	constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{ end() }; }
+	constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ end() }; }
+	constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator{ end() }; }
+	constexpr reverse_iterator rend() noexcept { return reverse_iterator{ begin() }; }
+	constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ begin() }; }
+	constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator{ begin() }; }
 
 	constexpr const char& at(size_t index) const
 	{
-		CONSTEXPR_ASSERT(index < size_, "Attempt to access a non-existing index of a constant string");
+		CONSTEXPR_BOUNDS_ASSERT(index < size_, "Attempt to access a non-existing index of a constant string");
 		return cstr_[index];
 	}
 
@@ -74,55 +80,59 @@ public:
 	
 	constexpr ConstString drop(size_t num) const
 	{
-		ConstString tmp{*this};
-		tmp.cstr_ += num;
-		tmp.size_ = size() - num;
-		
-		return (num < size() ? tmp : throw std::out_of_range("Attempt to access a non-existing index of a constant string"));
+		if(num >= size())
+		{
+			CONSTEXPR_THROW(std::out_of_range, "Attempt to access a non-existing index of a constant string");
+		}
+		return {cstr_ + num, size_ - num};
 	}
 	
-	constexpr ConstString drop(const_iterator it) const
+	// The same as drop, without exceptions : empty if num is not the index of a character.
+	constexpr std::optional<ConstString> try_drop(size_t num) const noexcept
 	{
-		size_t interval = it - begin();
-		ConstString tmp{*this};
-		tmp.cstr_ += interval;
-		tmp.size_ = end() - it;
-		
-		return (it >= begin() && it < end() ? tmp : throw std::out_of_range("Attempt to access a non-existing index of a constant string"));
+		if(num >= size())
+		{
+			return std::nullopt;
+		}
+		return ConstString{cstr_ + num, size_ - num};
 	}
 	
-	constexpr auto find(char c) const noexcept
-	-> decltype(begin())
+	// The first num characters, or the whole string if it is shorter.
+	constexpr ConstString take(size_t num) const noexcept
 	{
-		for(auto it = begin(); it != end(); ++it)
+		return {cstr_, num < size() ? num : size()};
+	}
+	
+	// The iterator overloads are templates, so that a literal 0 is an index, even when the iterators are pointers.
+	template<class Iterator, typename std::enable_if<std::is_same<Iterator, const_iterator>::value, bool>::type = false>
+	constexpr ConstString drop(Iterator it) const
+	{
+		if(!(it >= begin() && it < end()))
+		{
+			CONSTEXPR_THROW(std::out_of_range, "Attempt to access a non-existing index of a constant string");
+		}
+		return {cstr_ + (it - begin()), static_cast<size_t>(end() - it)};
+	}
+	
+	template<class Iterator, typename std::enable_if<std::is_same<Iterator, const_iterator>::value, bool>::type = false>
+	constexpr std::optional<ConstString> try_drop(Iterator it) const noexcept
+	{
+		if(!(it >= begin() && it < end()))
 		{
-			if(*it == c)
-			{
-				return it; 
-			}
+			return std::nullopt;
 		}
-		return end();
+		return ConstString{cstr_ + (it - begin()), static_cast<size_t>(end() - it)};
+	}
+	
+	constexpr auto find(char c) const noexcept
+	-> decltype(begin())
+	{
+		return begin() + Details::findByte(data(), size(), c);
 	}
 
-	// Modified to build with visual studio. Gcc and clang do not need recursion, simple if branches and for loop are working.
 	friend constexpr bool operator==(const ConstString& lhs, const ConstString& rhs);
+	friend constexpr std::strong_ordering operator<=>(const ConstString& lhs, const ConstString& rhs);
 	
-	/* Alternative definition, working on GCC 5.2.0 and Clang 3.7
-	It also avoid the recursion depth problem with big strings
-	
-	constexpr bool operator==(const ConstString& rhs) const
-    {
-        if(size_ != rhs.size()) return false;
-        for(uint8_t i = 0; i < size_; ++i)
-        {
-            if((*this)[i] != rhs[i])
-            {
-                return false;
-            }
-        }
-        return true;
-    }
-	*/
 	constexpr size_t size() const noexcept { return size_; }
 	constexpr pointer data() const noexcept { return cstr_; }
 	
@@ -147,7 +157,13 @@ protected:
 
 constexpr bool operator==(const ConstString& lhs, const ConstString& rhs)
 {
-	return lhs.size() != rhs.size() ? false : Details::equalAux(lhs.size(), lhs, rhs);
+	return lhs.size() != rhs.size() ? false : Details::equalBytes(lhs.data(), rhs.data(), lhs.size());
+}
+
+// Lexicographical order, bytes being compared as unsigned.
+constexpr std::strong_ordering operator<=>(const ConstString& lhs, const ConstString& rhs)
+{
+	return Details::compareBytes(lhs.data(), lhs.size(), rhs.data(), rhs.size());
 }
 
 #endif // CONST_STRING_HXX
\ No newline at end of file
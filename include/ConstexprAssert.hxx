@@ -1,9 +1,9 @@
 #ifndef CONSTEXPR_ASSERT_HXX
 #define CONSTEXPR_ASSERT_HXX
 
-#include <cassert>
-#include <cstdlib>
 #include <cstdio>
+#include <cstdlib>
+#include <type_traits>
 
 //#include <ConstString.hxx>
 #include <Platform.hxx>
@@ -18,26 +18,84 @@
  * https://www.google.fr/url?sa=t&rct=j&q=&esrc=s&source=web&cd=2&ved=0ahUKEwin9ZDnwMvMAhWJA8AKHc7fDJ0QFggmMAE&url=http%3A%2F%2Fwww.open-std.org%2Fjtc1%2Fsc22%2Fwg21%2Fdocs%2Fpapers%2F2014%2Fn4293.pdf&usg=AFQjCNHRfOCc2KsD16oCJWg6KK3pClTp1Q&sig2=Rt6qGhRRtCW76YhxaturVQ
  */
 
-#define CONSTEXPR_ASSERT(condition, msg) condition ? 																			\
-										 int{} : 																				\
-										 throw Details::ConstexprAssertFailure([](const char* assertMsg) { 						\
-										     std::fprintf(stderr, "Assertion failure: %s\n", assertMsg); assert(!#condition); 	\
-										 }, msg)
+/* Checks are sorted in two levels, chosen library-wide by CONSTEXPR_CHECK_LEVEL :
+ * - CONSTEXPR_CHECK_BOUNDS : the cheap checks of CONSTEXPR_BOUNDS_ASSERT only, guarding accesses by index, pops
+ *   on empty ranges, and writes past a capacity.
+ * - CONSTEXPR_CHECK_FULL : every check, including the ones of CONSTEXPR_ASSERT, which may cost more than the
+ *   operation they guard, like the order of the bounds of a range, or the comparison of checked iterators.
+ * - CONSTEXPR_CHECK_NONE : no check at runtime.
+ * By default, debug builds do every check, and other builds the bounds checks only. Whatever the level, a failing
+ * check is still an error in a constant expression, as it is free there.
+ * The failure path is an out of line, cold function, so that only a compare and a branch are left in the callers.
+ */
+#define CONSTEXPR_CHECK_NONE 0
+#define CONSTEXPR_CHECK_BOUNDS 1
+#define CONSTEXPR_CHECK_FULL 2
+
+#ifndef CONSTEXPR_CHECK_LEVEL
+#	if DEBUG
+#		define CONSTEXPR_CHECK_LEVEL CONSTEXPR_CHECK_FULL
+#	else
+#		define CONSTEXPR_CHECK_LEVEL CONSTEXPR_CHECK_BOUNDS
+#	endif
+#endif
+
+// Calling the failure function, which is not constexpr, is what makes a failing check a compilation error.
+#define CONSTEXPR_CHECK(condition, msg) (condition) ?			\
+										 int{} :								\
+										 (::Details::constexprAssertFailure(msg, #condition, __FILE__, __LINE__), int{})
+
+#define CONSTEXPR_CHECK_CONSTANT(condition, msg) (!std::is_constant_evaluated() || (condition)) ?			\
+										 int{} :								\
+										 (::Details::constexprAssertFailure(msg, #condition, __FILE__, __LINE__), int{})
+
+// For the paths that are an error anyway : this costs nothing, so it is done at every level.
+#define CONSTEXPR_FAIL(msg) ::Details::constexprAssertFailure(msg, "unreachable", __FILE__, __LINE__)
+
+/* The few functions reporting errors with exceptions, as their standard counterparts do, terminate instead when
+ * CONSTEXPR_EXCEPTIONS is false, which is the default when the compiler has exceptions disabled (-fno-exceptions).
+ * Every such function has a try_ variant returning an empty std::optional instead, whatever the mode. The library
+ * does not use RTTI.
+ */
+#ifndef CONSTEXPR_EXCEPTIONS
+#	if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#		define CONSTEXPR_EXCEPTIONS 1
+#	else
+#		define CONSTEXPR_EXCEPTIONS 0
+#	endif
+#endif
+
+#if CONSTEXPR_EXCEPTIONS
+#	define CONSTEXPR_THROW(exception, msg) throw exception(msg)
+#else
+#	define CONSTEXPR_THROW(exception, msg) CONSTEXPR_FAIL(msg)
+#endif
+
+#if CONSTEXPR_CHECK_LEVEL >= CONSTEXPR_CHECK_FULL
+#	define CONSTEXPR_ASSERT(condition, msg) CONSTEXPR_CHECK(condition, msg)
+#else
+#	define CONSTEXPR_ASSERT(condition, msg) CONSTEXPR_CHECK_CONSTANT(condition, msg)
+#endif
+
+#if CONSTEXPR_CHECK_LEVEL >= CONSTEXPR_CHECK_BOUNDS
+#	define CONSTEXPR_BOUNDS_ASSERT(condition, msg) CONSTEXPR_CHECK(condition, msg)
+#else
+#	define CONSTEXPR_BOUNDS_ASSERT(condition, msg) CONSTEXPR_CHECK_CONSTANT(condition, msg)
+#endif
 
 namespace Details
 {
 
-class ConstexprAssertFailure
+[[noreturn]] cold_noinline inline void constexprAssertFailure(const char* msg, const char* condition, const char* file, int line) noexcept
 {
-	public:
-	template<class Fn>
-	constexpr ConstexprAssertFailure(Fn&& fn, const char* msg)
-	{
-		fn(msg);
-		std::quick_exit(EXIT_FAILURE);
-	}
-};
+	std::fprintf(stderr, "Assertion failure: %s\n%s:%d: %s\n", msg, file, line, condition);
+#if DEBUG
+	std::abort();
+#else
+	std::quick_exit(EXIT_FAILURE);
+#endif
+}
 
 }
 
-#endif // CONSTEXPR_ASSERT_HXX
\ No newline at end of file
+#endif // CONSTEXPR_ASSERT_HXX
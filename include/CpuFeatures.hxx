@@ -0,0 +1,130 @@
+#ifndef CPU_FEATURES_HXX
+#define CPU_FEATURES_HXX
+
+#include <cstdint>
+
+#include <Platform.hxx>
+
+#if CPU_DISPATCH
+#if COMPILER == MSVC_COMPILER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/* Instruction sets of the machine the program runs on, read once with cpuid, for the kernels compiled for several
+ * of them (see CPU_DISPATCH in Platform.hxx) :
+ *     if(Details::cpuFeatures().avx2) return findAvx2(data, size);
+ * A set needing the wider registers is only reported if the operating system saves them on context switches.
+ * Outside x86, or with an unknown compiler, no set is reported, and the portable implementations are used.
+ */
+
+namespace Details
+{
+
+struct CpuFeatures
+{
+	bool ssse3;
+	bool avx2;
+	bool avx512bw;
+};
+
+#if CPU_DISPATCH
+// Registers eax, ebx, ecx and edx after cpuid, for the given leaf and subleaf.
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&registers)[4]) noexcept
+{
+#if COMPILER == MSVC_COMPILER
+	int values[4];
+	__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+	for(size_t i = 0; i < 4; ++i)
+	{
+		registers[i] = static_cast<uint32_t>(values[i]);
+	}
+#else
+	if(!__get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]))
+	{
+		registers[0] = registers[1] = registers[2] = registers[3] = 0;
+	}
+#endif
+}
+
+// The register states saved by the operating system (XCR0).
+inline uint64_t enabledRegisterStates() noexcept
+{
+#if COMPILER == MSVC_COMPILER
+	return _xgetbv(0);
+#else
+	uint32_t low, high;
+	__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+	return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+}
+#endif
+
+inline CpuFeatures detectCpuFeatures() noexcept
+{
+	CpuFeatures features{};
+#if CPU_DISPATCH
+	uint32_t registers[4];
+	cpuid(0, 0, registers);
+	const uint32_t maxLeaf = registers[0];
+
+	cpuid(1, 0, registers);
+	features.ssse3 = (registers[2] >> 9) & 1;
+	const bool osSavesRegisters = (registers[2] >> 27) & 1;
+
+	if(osSavesRegisters && maxLeaf >= 7)
+	{
+		const uint64_t states = enabledRegisterStates();
+		// SSE and AVX states for the ymm registers, plus the opmask and zmm ones for AVX-512.
+		const bool ymm = (states & 0x6) == 0x6;
+		const bool zmm = (states & 0xE6) == 0xE6;
+
+		cpuid(7, 0, registers);
+		features.avx2 = ymm && ((registers[1] >> 5) & 1);
+		// AVX512BW is only usable with the foundation.
+		features.avx512bw = zmm && ((registers[1] >> 16) & 1) && ((registers[1] >> 30) & 1);
+	}
+#endif
+	return features;
+}
+
+// Detected on the first call, then cached.
+inline const CpuFeatures& cpuFeatures() noexcept
+{
+	static const CpuFeatures features = detectCpuFeatures();
+	return features;
+}
+
+// Whether a set can be used, known at compile time when the build targets it.
+inline bool supportsSsse3() noexcept
+{
+#if defined(__SSSE3__)
+	return true;
+#else
+	return cpuFeatures().ssse3;
+#endif
+}
+
+inline bool supportsAvx2() noexcept
+{
+#if defined(__AVX2__)
+	return true;
+#else
+	return cpuFeatures().avx2;
+#endif
+}
+
+inline bool supportsAvx512bw() noexcept
+{
+#if defined(__AVX512BW__)
+	return true;
+#else
+	return cpuFeatures().avx512bw;
+#endif
+}
+
+}
+
+#endif // CPU_FEATURES_HXX
@@ -0,0 +1,125 @@
+#ifndef ENUM_DECORATED_NAMES_HXX
+#define ENUM_DECORATED_NAMES_HXX
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <ConstString.hxx>
+#include <StaticString.hxx>
+#include <StringDetails.hxx>
+
+/* Decorated forms of the names of an IMPROVED_ENUM, built at compile time :
+ * the qualified names ("EnumName::Value") and the debug names ("Value(7)").
+ * Each table is a single character array holding every string, null terminated, and an array of ConstString
+ * pointing inside it, in the order of EnumName::values(). Getting the decorated name of an enumerator is thus
+ * a single table load once its index is known.
+ */
+
+namespace EnumUtils
+{
+
+template<class EnumName>
+class DecoratedNames
+{
+	static constexpr size_t size_ = EnumName::size();
+
+	using UnderlyingType = typename EnumName::underlying_type;
+
+	static constexpr StaticString<::Details::maxIntegerDigits> valueString(size_t index) noexcept
+	{
+		// Widened, so that the character types are formatted as the numbers they hold.
+		using WideType = std::conditional_t<std::is_signed<UnderlyingType>::value, int64_t, uint64_t>;
+		return toStaticString(static_cast<WideType>(static_cast<UnderlyingType>(EnumName::values()[index])));
+	}
+
+	static constexpr size_t qualifiedSize() noexcept
+	{
+		size_t total = 0;
+		for(size_t index = 0; index < size_; ++index)
+		{
+			total += EnumName::get_enum_name().size() + EnumName::names()[index].size() + 3;
+		}
+		return total;
+	}
+
+	static constexpr size_t debugSize() noexcept
+	{
+		size_t total = 0;
+		for(size_t index = 0; index < size_; ++index)
+		{
+			total += EnumName::names()[index].size() + valueString(index).size() + 3;
+		}
+		return total;
+	}
+
+	template<size_t Tsize>
+	struct Table
+	{
+		std::array<char, Tsize> chars;
+		std::array<size_t, size_> offsets;
+		std::array<size_t, size_> sizes;
+	};
+
+	static constexpr void write(char* chars, size_t& offset, ConstString part) noexcept
+	{
+		::Details::copyBytes(chars + offset, part.data(), part.size());
+		offset += part.size();
+	}
+
+	static constexpr Table<qualifiedSize()> buildQualified() noexcept
+	{
+		Table<qualifiedSize()> table{};
+		size_t offset = 0;
+		for(size_t index = 0; index < size_; ++index)
+		{
+			table.offsets[index] = offset;
+			write(table.chars.data(), offset, EnumName::get_enum_name());
+			write(table.chars.data(), offset, "::");
+			write(table.chars.data(), offset, EnumName::names()[index]);
+			table.sizes[index] = offset - table.offsets[index];
+			table.chars[offset++] = '\0';
+		}
+		return table;
+	}
+
+	static constexpr Table<debugSize()> buildDebug() noexcept
+	{
+		Table<debugSize()> table{};
+		size_t offset = 0;
+		for(size_t index = 0; index < size_; ++index)
+		{
+			const auto decorated = '(' + valueString(index) + ')';
+			table.offsets[index] = offset;
+			write(table.chars.data(), offset, EnumName::names()[index]);
+			write(table.chars.data(), offset, decorated);
+			table.sizes[index] = offset - table.offsets[index];
+			table.chars[offset++] = '\0';
+		}
+		return table;
+	}
+
+	static constexpr Table<qualifiedSize()> qualifiedTable_ = buildQualified();
+	static constexpr Table<debugSize()> debugTable_ = buildDebug();
+
+	template<size_t Tsize>
+	static constexpr std::array<ConstString, size_> makeNames(const Table<Tsize>& table) noexcept
+	{
+		return makeNamesAux(table, std::make_index_sequence<size_>{});
+	}
+
+	template<size_t Tsize, size_t ... indices>
+	static constexpr std::array<ConstString, size_> makeNamesAux(const Table<Tsize>& table, std::index_sequence<indices...>) noexcept
+	{
+		return {{ConstString{table.chars.data() + table.offsets[indices], table.sizes[indices]}...}};
+	}
+
+public:
+	static constexpr std::array<ConstString, size_> qualified_ = makeNames(qualifiedTable_);
+	static constexpr std::array<ConstString, size_> debug_ = makeNames(debugTable_);
+};
+
+}
+
+#endif // ENUM_DECORATED_NAMES_HXX
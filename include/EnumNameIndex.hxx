@@ -0,0 +1,329 @@
+#ifndef ENUM_NAME_INDEX_HXX
+#define ENUM_NAME_INDEX_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <AsciiCase.hxx>
+#include <ConstexprAssert.hxx>
+#include <ConstString.hxx>
+#include <Range.hxx>
+#include <StringDetails.hxx>
+
+/* Compile time index over the names of an IMPROVED_ENUM, used for the name based lookups.
+ * The names are sorted, and the length of the prefix shared by each name with the previous one is stored
+ * alongside (the usual LCP table). Names sharing a prefix are thus contiguous, and a prefix lookup is
+ * a binary search, where characters already known to match are never compared again.
+ * Exact lookups use an open addressing table keyed by the precomputed EnumName::name_hashes(), and case
+ * insensitive ones a second table, keyed by the hash of the case folded names.
+ */
+
+namespace EnumUtils
+{
+
+enum class StringCase : uint8_t
+{
+	Sensitive,
+	Insensitive
+};
+
+enum class PrefixMatchStatus : uint8_t
+{
+	None,
+	Unique,
+	Ambiguous
+};
+
+/* Result of EnumName::match_prefix().
+ * The candidates are all the enumerators whose name starts with the prefix, sorted by name.
+ * The match is unique if there is only one candidate, or if the prefix is exactly one of the names
+ * (the value is then this enumerator, and the other candidates are the longer names).
+ */
+template<class EnumName>
+class PrefixMatch
+{
+public:
+	constexpr PrefixMatch(PrefixMatchStatus status, const EnumName* first, const EnumName* last) noexcept
+	: status_{status}, first_{first}, last_{last}
+	{}
+
+	constexpr PrefixMatchStatus status() const noexcept { return status_; }
+	constexpr bool is_unique() const noexcept { return status_ == PrefixMatchStatus::Unique; }
+	constexpr bool is_ambiguous() const noexcept { return status_ == PrefixMatchStatus::Ambiguous; }
+	constexpr bool empty() const noexcept { return status_ == PrefixMatchStatus::None; }
+
+	constexpr const EnumName& value() const
+	{
+		CONSTEXPR_BOUNDS_ASSERT(is_unique(), "The prefix do not designate a single enumerator");
+		return *first_;
+	}
+
+	constexpr range<const EnumName*> candidates() const noexcept
+	{
+		return {first_, last_};
+	}
+
+	constexpr size_t size() const noexcept
+	{
+		return last_ - first_;
+	}
+
+private:
+	PrefixMatchStatus status_;
+	const EnumName* first_;
+	const EnumName* last_;
+};
+
+namespace Details
+{
+
+// Length of the common prefix of lhs and rhs, knowing that the first 'from' characters are equal.
+constexpr size_t commonPrefixLength(ConstString lhs, ConstString rhs, size_t from = 0) noexcept
+{
+	const size_t size = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+	size_t i = from;
+	while(i < size && lhs.data()[i] == rhs.data()[i])
+	{
+		++i;
+	}
+	return i;
+}
+
+constexpr bool nameLess(ConstString lhs, ConstString rhs) noexcept
+{
+	const size_t common = commonPrefixLength(lhs, rhs);
+	return common == lhs.size() ? common != rhs.size()
+	     : common == rhs.size() ? false
+	     : static_cast<unsigned char>(lhs.data()[common]) < static_cast<unsigned char>(rhs.data()[common]);
+}
+
+}
+
+template<class EnumName>
+class NameIndex
+{
+	static constexpr size_t size_ = EnumName::size();
+
+	using OrderType = std::array<size_t, size_>;
+
+	static constexpr OrderType sortedOrder() noexcept
+	{
+		OrderType order{};
+		for(size_t i = 0; i < size_; ++i)
+		{
+			order[i] = i;
+		}
+		std::sort(order.begin(), order.end(), [](size_t lhs, size_t rhs) {
+			return Details::nameLess(EnumName::names()[lhs], EnumName::names()[rhs]);
+		});
+		return order;
+	}
+
+	static constexpr OrderType order_ = sortedOrder();
+
+	template<class T, class Fn>
+	static constexpr std::array<T, size_> mapOrder(Fn fn) noexcept
+	{
+		return mapOrderAux<T>(fn, std::make_index_sequence<size_>{});
+	}
+
+	template<class T, class Fn, size_t ... indices>
+	static constexpr std::array<T, size_> mapOrderAux(Fn fn, std::index_sequence<indices...>) noexcept
+	{
+		return {{fn(order_[indices])...}};
+	}
+
+	// Power of two at least twice the number of names, to keep probe sequences short.
+	static constexpr size_t hashTableSize() noexcept
+	{
+		size_t tableSize = 2;
+		while(tableSize < 2 * size_)
+		{
+			tableSize *= 2;
+		}
+		return tableSize;
+	}
+
+	static constexpr size_t hashTableSize_ = hashTableSize();
+
+	// Position + 1 of the name in the sorted names, 0 for an empty slot.
+	using HashSlotsType = std::array<uint32_t, hashTableSize_>;
+
+	struct FoldedTable
+	{
+		HashSlotsType slots;
+		bool hasCollision;
+	};
+
+	static constexpr std::array<size_t, size_> sharedPrefixes() noexcept
+	{
+		std::array<size_t, size_> lcp{};
+		for(size_t i = 1; i < size_; ++i)
+		{
+			lcp[i] = Details::commonPrefixLength(EnumName::names()[order_[i - 1]], EnumName::names()[order_[i]]);
+		}
+		return lcp;
+	}
+
+public:
+	static constexpr std::array<EnumName, size_> values_ = mapOrder<EnumName>([](size_t index) { return EnumName{EnumName::values()[index]}; });
+	static constexpr std::array<ConstString, size_> names_ = mapOrder<ConstString>([](size_t index) { return EnumName::names()[index]; });
+	// shared_[i] is the length of the prefix shared by names_[i - 1] and names_[i].
+	static constexpr std::array<size_t, size_> shared_ = sharedPrefixes();
+	static constexpr std::array<uint64_t, size_> hashes_ = mapOrder<uint64_t>([](size_t index) { return EnumName::name_hashes()[index]; });
+
+private:
+	static constexpr HashSlotsType buildExactTable() noexcept
+	{
+		HashSlotsType slots{};
+		for(size_t position = 0; position < size_; ++position)
+		{
+			size_t slot = hashes_[position] & (hashTableSize_ - 1);
+			while(slots[slot] != 0)
+			{
+				slot = (slot + 1) & (hashTableSize_ - 1);
+			}
+			slots[slot] = static_cast<uint32_t>(position + 1);
+		}
+		return slots;
+	}
+
+	static constexpr FoldedTable buildFoldedTable() noexcept
+	{
+		FoldedTable table{};
+		for(size_t position = 0; position < size_; ++position)
+		{
+			size_t slot = ::Details::hashIgnoreCase(names_[position]) & (hashTableSize_ - 1);
+			while(table.slots[slot] != 0)
+			{
+				table.hasCollision = table.hasCollision || ::Details::equalIgnoreCase(names_[table.slots[slot] - 1], names_[position]);
+				slot = (slot + 1) & (hashTableSize_ - 1);
+			}
+			table.slots[slot] = static_cast<uint32_t>(position + 1);
+		}
+		return table;
+	}
+
+	static constexpr HashSlotsType exactTable_ = buildExactTable();
+	static constexpr FoldedTable foldedTable_ = buildFoldedTable();
+
+public:
+	// Return the enumerator having this name, or nullptr.
+	template<StringCase sensitivity = StringCase::Sensitive>
+	static constexpr const EnumName* find(ConstString name) noexcept
+	{
+		if constexpr(sensitivity == StringCase::Sensitive)
+		{
+			const uint64_t hash = ::Details::hashBytes(name.data(), name.size());
+			for(size_t slot = hash & (hashTableSize_ - 1); exactTable_[slot] != 0; slot = (slot + 1) & (hashTableSize_ - 1))
+			{
+				const size_t position = exactTable_[slot] - 1;
+				if(hashes_[position] == hash && names_[position] == name)
+				{
+					return values_.data() + position;
+				}
+			}
+			return nullptr;
+		}
+		else
+		{
+			static_assert(!foldedTable_.hasCollision, "Some names of the enumeration are the same when ignoring case");
+
+			for(size_t slot = ::Details::hashIgnoreCase(name) & (hashTableSize_ - 1);
+			    foldedTable_.slots[slot] != 0;
+			    slot = (slot + 1) & (hashTableSize_ - 1))
+			{
+				const size_t position = foldedTable_.slots[slot] - 1;
+				if(::Details::equalIgnoreCase(names_[position], name))
+				{
+					return values_.data() + position;
+				}
+			}
+			return nullptr;
+		}
+	}
+
+	static constexpr PrefixMatch<EnumName> match_prefix(ConstString prefix) noexcept
+	{
+		const size_t first = lowerBound(prefix);
+		if(first == size_ || Details::commonPrefixLength(names_[first], prefix) != prefix.size())
+		{
+			return {PrefixMatchStatus::None, values_.data(), values_.data()};
+		}
+
+		const size_t last = upperBound(prefix, first);
+		const bool unique = last - first == 1 || names_[first].size() == prefix.size();
+		return {unique ? PrefixMatchStatus::Unique : PrefixMatchStatus::Ambiguous, values_.data() + first, values_.data() + last};
+	}
+
+private:
+	// Index of the first name not ordered before the prefix. A name starting with the prefix is not before it.
+	static constexpr size_t lowerBound(ConstString prefix) noexcept
+	{
+		// Invariant : names before 'low' are lesser, names from 'high' are not, and the prefix shares
+		// lowMatch (resp. highMatch) characters with the name just before low (resp. at high).
+		size_t low = 0;
+		size_t high = size_;
+		size_t lowMatch = 0;
+		size_t highMatch = 0;
+
+		while(low < high)
+		{
+			const size_t mid = low + (high - low) / 2;
+			const ConstString name = names_[mid];
+			const size_t match = Details::commonPrefixLength(name, prefix, lowMatch < highMatch ? lowMatch : highMatch);
+
+			const bool before = match != prefix.size()
+			                 && (match == name.size()
+			                 || static_cast<unsigned char>(name.data()[match]) < static_cast<unsigned char>(prefix.data()[match]));
+			if(before)
+			{
+				low = mid + 1;
+				lowMatch = match;
+			}
+			else
+			{
+				high = mid;
+				highMatch = match;
+			}
+		}
+		return low;
+	}
+
+	// Index of the first name after 'first' not starting with the prefix, knowing that names_[first] does.
+	static constexpr size_t upperBound(ConstString prefix, size_t first) noexcept
+	{
+		// Quick exit for the common unambiguous case, without comparing any character.
+		if(first + 1 == size_ || shared_[first + 1] < prefix.size())
+		{
+			return first + 1;
+		}
+
+		size_t low = first + 2;
+		size_t high = size_;
+		size_t highMatch = 0;
+
+		while(low < high)
+		{
+			const size_t mid = low + (high - low) / 2;
+			const size_t match = Details::commonPrefixLength(names_[mid], prefix, highMatch);
+
+			if(match == prefix.size())
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+				highMatch = match;
+			}
+		}
+		return low;
+	}
+};
+
+}
+
+#endif // ENUM_NAME_INDEX_HXX
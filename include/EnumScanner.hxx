@@ -0,0 +1,292 @@
+#ifndef ENUM_SCANNER_HXX
+#define ENUM_SCANNER_HXX
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <ByteSet.hxx>
+#include <ConstString.hxx>
+
+/* Multi-pattern search of every enumerator name of an IMPROVED_ENUM inside a text stream.
+ * The scanner is an Aho-Corasick automaton built at compile time from EnumName::names(), and
+ * flattened into a complete DFA : scanning a byte is a single table load, whatever the number of names.
+ * To keep the transition table small, the alphabet is reduced to the bytes actually appearing in the names,
+ * every other byte being mapped to the same class (which always leads back to the root).
+ * The automaton state is kept between calls, so a stream can be fed chunk by chunk, and a name spanning
+ * two chunks is still reported.
+ * As most of the text usually does not match anything, while in the root state the scanner skips ahead
+ * to the next byte able to start a name, testing 16 or 32 bytes at once with Details::ByteSet.
+ */
+
+namespace EnumUtils
+{
+
+namespace Details
+{
+
+template<class T>
+constexpr size_t scannerStateCount(const T& names) noexcept
+{
+	size_t count = 1;
+	for(const auto& name : names)
+	{
+		count += name.size();
+	}
+	return count;
+}
+
+template<class T>
+constexpr std::array<uint8_t, 256> scannerByteClasses(const T& names) noexcept
+{
+	std::array<uint8_t, 256> classes{};
+	uint8_t next = 1;
+	for(const auto& name : names)
+	{
+		for(size_t i = 0; i < name.size(); ++i)
+		{
+			auto& cls = classes[static_cast<unsigned char>(name.data()[i])];
+			if(cls == 0)
+			{
+				cls = next++;
+			}
+		}
+	}
+	return classes;
+}
+
+// Rounded up to a power of two, so that going from a transition to its state index is a shift,
+// and so that the lowest bit of a transition is free to flag states having something to report.
+template<class T>
+constexpr size_t scannerClassCount(const T& names) noexcept
+{
+	size_t count = 1;
+	for(auto cls : scannerByteClasses(names))
+	{
+		count = cls >= count ? cls + 1 : count;
+	}
+
+	size_t rounded = 1;
+	while(rounded < count)
+	{
+		rounded *= 2;
+	}
+	return rounded;
+}
+
+template<size_t maxValue>
+using ScannerIndexType = std::conditional_t<(maxValue <= UINT16_MAX), uint16_t, uint32_t>;
+
+template<class T>
+constexpr ::Details::ByteSet scannerStartSet(const T& names) noexcept
+{
+	::Details::ByteSet set{};
+	for(const auto& name : names)
+	{
+		set.insert(name.data()[0]);
+	}
+	return set;
+}
+
+template<size_t stateCount, size_t classCount>
+struct ScannerAutomaton
+{
+	// Transitions are stored pre-multiplied by the class count, so the next row is directly addressable.
+	// The lowest bit is set when the target state, or one of its failure states, ends a name.
+	using StateType = ScannerIndexType<stateCount * classCount>;
+	using NameIndexType = ScannerIndexType<stateCount>;
+
+	static constexpr NameIndexType noName = 0;
+	static constexpr StateType reportFlag = 1;
+	static constexpr StateType rowMask = static_cast<StateType>(~reportFlag);
+
+	std::array<uint8_t, 256> classes;
+	std::array<StateType, stateCount * classCount> transitions;
+	// Index + 1 of the name ending at the state, or noName.
+	std::array<NameIndexType, stateCount> outputs;
+	// Next state on the failure chain having an output, or 0 (the root never has one).
+	std::array<StateType, stateCount> outputLinks;
+};
+
+template<size_t stateCount, size_t classCount, class T>
+constexpr ScannerAutomaton<stateCount, classCount> buildScannerAutomaton(const T& names) noexcept
+{
+	using Automaton = ScannerAutomaton<stateCount, classCount>;
+	using StateType = typename Automaton::StateType;
+
+	constexpr StateType noState = static_cast<StateType>(-1);
+
+	Automaton automaton{};
+	automaton.classes = scannerByteClasses(names);
+
+	std::array<StateType, stateCount * classCount> trie{};
+	for(auto& transition : trie)
+	{
+		transition = noState;
+	}
+
+	// Build the trie, with states being plain indices.
+	StateType stateUsed = 1;
+	for(size_t nameIndex = 0; nameIndex < names.size(); ++nameIndex)
+	{
+		const auto& name = names[nameIndex];
+		StateType state = 0;
+		for(size_t i = 0; i < name.size(); ++i)
+		{
+			auto& next = trie[state * classCount + automaton.classes[static_cast<unsigned char>(name.data()[i])]];
+			if(next == noState)
+			{
+				next = stateUsed++;
+			}
+			state = next;
+		}
+		automaton.outputs[state] = static_cast<typename Automaton::NameIndexType>(nameIndex + 1);
+	}
+
+	// Breadth first traversal to compute failure links, and complete the DFA at the same time.
+	// A state failure row is always complete when we reach it, as it is shallower.
+	std::array<StateType, stateCount> failures{};
+	std::array<StateType, stateCount> queue{};
+	size_t queueBegin = 0;
+	size_t queueEnd = 0;
+
+	for(size_t cls = 0; cls < classCount; ++cls)
+	{
+		auto& next = trie[cls];
+		if(next == noState)
+		{
+			next = 0;
+		}
+		else
+		{
+			failures[next] = 0;
+			queue[queueEnd++] = next;
+		}
+	}
+
+	while(queueBegin != queueEnd)
+	{
+		StateType state = queue[queueBegin++];
+		StateType failure = failures[state];
+
+		automaton.outputLinks[state] = automaton.outputs[failure] != Automaton::noName ? failure : automaton.outputLinks[failure];
+
+		for(size_t cls = 0; cls < classCount; ++cls)
+		{
+			auto& next = trie[state * classCount + cls];
+			if(next == noState)
+			{
+				next = trie[failure * classCount + cls];
+			}
+			else
+			{
+				failures[next] = trie[failure * classCount + cls];
+				queue[queueEnd++] = next;
+			}
+		}
+	}
+
+	// Rows past the used states are never reached, as the state count is only an upper bound.
+	for(size_t i = 0; i < stateUsed * classCount; ++i)
+	{
+		const StateType target = trie[i];
+		const bool reportable = automaton.outputs[target] != Automaton::noName || automaton.outputLinks[target] != 0;
+		automaton.transitions[i] = static_cast<StateType>(target * classCount + (reportable ? Automaton::reportFlag : 0));
+	}
+	for(size_t state = 0; state < stateCount; ++state)
+	{
+		automaton.outputLinks[state] = static_cast<StateType>(automaton.outputLinks[state] * classCount);
+	}
+
+	return automaton;
+}
+
+}
+
+template<class EnumName>
+class Scanner
+{
+	static constexpr size_t stateCount_ = Details::scannerStateCount(EnumName::names());
+	static constexpr size_t classCount_ = Details::scannerClassCount(EnumName::names());
+
+	using Automaton = Details::ScannerAutomaton<stateCount_, classCount_>;
+	using StateType = typename Automaton::StateType;
+
+	static constexpr Automaton automaton_ = Details::buildScannerAutomaton<stateCount_, classCount_>(EnumName::names());
+	static constexpr ::Details::ByteSet startSet_ = Details::scannerStartSet(EnumName::names());
+
+public:
+	constexpr Scanner() noexcept : state_{0}, offset_{0}
+	{}
+
+	/* Feed the next chunk of the stream. For every occurrence of an enumerator name ending inside this chunk,
+	 * onMatch(offset, value) is called, offset being the position of the first character of the name
+	 * from the beginning of the stream (it may thus be located in a previous chunk).
+	 * Occurrences are reported by increasing end position. Overlapping occurrences are all reported.
+	 */
+	template<class Callback>
+	constexpr void scan(ConstString chunk, Callback&& onMatch)
+	{
+		const char* data = chunk.data();
+		const size_t size = chunk.size();
+		StateType state = state_;
+
+		for(size_t i = 0; i < size; ++i)
+		{
+			if(state == 0 && !std::is_constant_evaluated())
+			{
+				i += startSet_.findFirstOf(data + i, size - i);
+				if(i == size)
+				{
+					break;
+				}
+			}
+
+			state = automaton_.transitions[(state & Automaton::rowMask) + automaton_.classes[static_cast<unsigned char>(data[i])]];
+
+			if(unlikely(state & Automaton::reportFlag))
+			{
+				report(state & Automaton::rowMask, offset_ + i + 1, onMatch);
+			}
+		}
+
+		state_ = state;
+		offset_ += size;
+	}
+
+	// Forget the current match state, to start scanning a new stream.
+	constexpr void reset() noexcept
+	{
+		state_ = 0;
+		offset_ = 0;
+	}
+
+	// Number of bytes scanned since the beginning of the stream.
+	constexpr size_t offset() const noexcept
+	{
+		return offset_;
+	}
+
+private:
+	template<class Callback>
+	static constexpr void report(StateType state, size_t endOffset, Callback& onMatch)
+	{
+		for(; state != 0; state = automaton_.outputLinks[state / classCount_])
+		{
+			auto output = automaton_.outputs[state / classCount_];
+			if(output != Automaton::noName)
+			{
+				const size_t index = output - 1;
+				onMatch(endOffset - EnumName::names()[index].size(), EnumName::enumerators()[index]);
+			}
+		}
+	}
+
+	StateType state_;
+	size_t offset_;
+};
+
+}
+
+#endif // ENUM_SCANNER_HXX
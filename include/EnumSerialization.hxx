@@ -0,0 +1,305 @@
+#ifndef ENUM_SERIALIZATION_HXX
+#define ENUM_SERIALIZATION_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include <Configuration.hxx>
+#include <CpuFeatures.hxx>
+#include <Platform.hxx>
+#include <Range.hxx>
+#include <RangeChunks.hxx>
+
+#if CPU_DISPATCH
+#include <immintrin.h>
+#endif
+
+/* Bulk conversion of enumeration values from and to a byte order, for arrays exchanged with other hosts :
+ *     EnumUtils::encode<Endianess::big>(states, buffer);
+ *     size_t valid = EnumUtils::decode<Endianess::big>(buffer, states);
+ * Each value takes the size of the underlying type of the enumeration. When the byte order is the one of the
+ * machine, the conversion is a plain copy. Otherwise, the bytes are swapped a register at a time with pshufb, using
+ * the widest instruction set of the machine (see CpuFeatures.hxx).
+ * Decoding checks that every value is one of the enumeration, a block at a time right after converting it, so that
+ * the values are checked while still in the cache : it stops at the first invalid value.
+ */
+
+namespace Details
+{
+
+// Reversal of the bytes of count values of width bytes, a byte at a time.
+template<size_t width>
+inline void swapBytesScalar(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+	for(size_t i = 0; i < count; ++i, in += width, out += width)
+	{
+		for(size_t j = 0; j < width; ++j)
+		{
+			out[j] = in[width - 1 - j];
+		}
+	}
+}
+
+// Shuffle control reversing each value of width bytes in a 16 bytes lane.
+template<size_t width>
+inline constexpr std::array<char, 16> swapBytesMask = [] {
+	std::array<char, 16> mask{};
+	for(size_t i = 0; i < mask.size(); ++i)
+	{
+		mask[i] = static_cast<char>(i / width * width + width - 1 - i % width);
+	}
+	return mask;
+}();
+
+// The same control repeated in the four lanes of a 64 bytes register, to be loaded as is.
+template<size_t width>
+inline constexpr std::array<char, 64> swapBytesMask512 = [] {
+	std::array<char, 64> mask{};
+	for(size_t i = 0; i < mask.size(); ++i)
+	{
+		mask[i] = swapBytesMask<width>[i % 16];
+	}
+	return mask;
+}();
+
+// The vector kernels, only to be called when the machine supports their instruction set.
+#if CPU_DISPATCH
+template<size_t width>
+target_feature("ssse3") void swapBytesSsse3(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+	const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swapBytesMask<width>.data()));
+	const auto blocks = range<const unsigned char*>{in, in + count * width} | views::chunks<16>();
+	for(std::span<const unsigned char, 16> block : blocks)
+	{
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data()));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + (block.data() - in)), _mm_shuffle_epi8(bytes, mask));
+	}
+	const auto tail = blocks.remainder();
+	swapBytesScalar<width>(tail.data(), out + (tail.data() - in), tail.size() / width);
+}
+
+template<size_t width>
+target_feature("avx2") void swapBytesAvx2(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+	// vpshufb shuffles each 128 bits lane apart, and values do not straddle lanes : the mask is the same in both.
+	const __m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(swapBytesMask<width>.data())));
+	const auto blocks = range<const unsigned char*>{in, in + count * width} | views::chunks<32>();
+	for(std::span<const unsigned char, 32> block : blocks)
+	{
+		const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.data()));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (block.data() - in)), _mm256_shuffle_epi8(bytes, mask));
+	}
+	const auto tail = blocks.remainder();
+	swapBytesScalar<width>(tail.data(), out + (tail.data() - in), tail.size() / width);
+}
+
+template<size_t width>
+target_feature("avx512f,avx512bw") void swapBytesAvx512(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+	const __m512i mask = _mm512_loadu_si512(swapBytesMask512<width>.data());
+	const auto blocks = range<const unsigned char*>{in, in + count * width} | views::chunks<64>();
+	for(std::span<const unsigned char, 64> block : blocks)
+	{
+		const __m512i bytes = _mm512_loadu_si512(block.data());
+		_mm512_storeu_si512(out + (block.data() - in), _mm512_shuffle_epi8(bytes, mask));
+	}
+	const auto tail = blocks.remainder();
+	swapBytesScalar<width>(tail.data(), out + (tail.data() - in), tail.size() / width);
+}
+#endif
+
+template<size_t width>
+inline void swapBytes(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+#if CPU_DISPATCH
+	if(supportsAvx512bw())
+	{
+		return swapBytesAvx512<width>(in, out, count);
+	}
+	if(supportsAvx2())
+	{
+		return swapBytesAvx2<width>(in, out, count);
+	}
+	if(supportsSsse3())
+	{
+		return swapBytesSsse3<width>(in, out, count);
+	}
+#endif
+	swapBytesScalar<width>(in, out, count);
+}
+
+// Copy of count values of width bytes, from a byte order to the other one if needed.
+template<Endianess order, size_t width>
+inline void convertBytes(const unsigned char* in, unsigned char* out, size_t count) noexcept
+{
+	if constexpr(order == nativeEndianess || width == 1)
+	{
+		// The pointers of an empty range may be null, which memcpy does not accept.
+		if(count != 0)
+		{
+			std::memcpy(out, in, count * width);
+		}
+	}
+	else
+	{
+		swapBytes<width>(in, out, count);
+	}
+}
+
+// Membership of a value in the values of an enumeration : a range check, a table, or a binary search.
+template<class Enum>
+class EnumValueSet
+{
+	using Underlying = typename Enum::underlying_type;
+	using Unsigned = std::make_unsigned_t<Underlying>;
+
+public:
+	static constexpr bool contains(Underlying value) noexcept
+	{
+		if constexpr(Enum::is_contiguous())
+		{
+			return static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(first)) < Enum::size();
+		}
+		else if constexpr(sizeof(Underlying) == 1)
+		{
+			return table[static_cast<Unsigned>(value)];
+		}
+		else
+		{
+			return std::binary_search(sorted.begin(), sorted.end(), value);
+		}
+	}
+
+private:
+	static constexpr Underlying first = Enum::size() != 0 ? static_cast<Underlying>(Enum::values()[0]) : Underlying{};
+
+	static constexpr std::array<bool, 256> table = [] {
+		std::array<bool, 256> result{};
+		for(const auto value : Enum::values())
+		{
+			result[static_cast<uint8_t>(value)] = true;
+		}
+		return result;
+	}();
+
+	static constexpr std::array<Underlying, Enum::size()> sorted = [] {
+		std::array<Underlying, Enum::size()> result{};
+		for(size_t i = 0; i < Enum::size(); ++i)
+		{
+			result[i] = static_cast<Underlying>(Enum::values()[i]);
+		}
+		std::sort(result.begin(), result.end());
+		return result;
+	}();
+};
+
+// Index of the first value of [values, values + count) not in the enumeration, or count.
+template<class Enum>
+inline size_t findInvalidValue(const Enum* values, size_t count) noexcept
+{
+	// Checking all the values before looking for the first invalid one keeps the common loop free of branches.
+	bool valid = true;
+	for(size_t i = 0; i < count; ++i)
+	{
+		valid &= EnumValueSet<Enum>::contains(values[i].to_value());
+	}
+	if(likely(valid))
+	{
+		return count;
+	}
+	for(size_t i = 0; i < count; ++i)
+	{
+		if(!EnumValueSet<Enum>::contains(values[i].to_value()))
+		{
+			return i;
+		}
+	}
+	return count;
+}
+
+template<class Range>
+using enum_of_range = std::remove_cv_t<std::remove_reference_t<decltype(*std::ranges::begin(std::declval<Range&>()))>>;
+
+template<class Enum>
+inline constexpr bool is_serializable_enum = std::is_trivially_copyable<Enum>::value
+										  && sizeof(Enum) == sizeof(typename Enum::underlying_type);
+
+}
+
+namespace EnumUtils
+{
+
+// Number of bytes taken by count values of the enumeration.
+template<class Enum>
+constexpr size_t encodedSize(size_t count) noexcept
+{
+	return count * sizeof(typename Enum::underlying_type);
+}
+
+// Writes the values of a contiguous range to out, which must hold encodedSize<Enum>(size) bytes, in the given order.
+template<Endianess order, ::Details::contiguous_sized_range Range>
+void encode(const Range& values, std::byte* out) noexcept
+{
+	using Enum = ::Details::enum_of_range<const Range>;
+	static_assert(::Details::is_serializable_enum<Enum>, "Only enumerations declared with IMPROVED_ENUM or ITERABLE_ENUM can be encoded");
+
+	::Details::convertBytes<order, sizeof(typename Enum::underlying_type)>(reinterpret_cast<const unsigned char*>(::Details::contiguous_data(values)),
+																		  reinterpret_cast<unsigned char*>(out), std::ranges::size(values));
+}
+
+/* Reads values from in, in the given order, to fill a contiguous range. Returns the number of values read before the
+ * first one which is not a value of the enumeration, which is the size of the range if they are all valid. The
+ * elements of the range after this first invalid value are left unspecified.
+ */
+template<Endianess order, ::Details::contiguous_sized_range Range>
+size_t decode(const std::byte* in, Range&& values) noexcept
+{
+	using Enum = ::Details::enum_of_range<Range>;
+	using Underlying = typename Enum::underlying_type;
+	static_assert(::Details::is_serializable_enum<Enum>, "Only enumerations declared with IMPROVED_ENUM or ITERABLE_ENUM can be decoded");
+	// Blocks of a few cache lines, checked right after being converted.
+	constexpr size_t blockSize = 512 / sizeof(Underlying);
+
+	Enum* first = ::Details::contiguous_data(values);
+	const auto source = reinterpret_cast<const unsigned char*>(in);
+	const auto convertAndCheck = [&](Enum* block, size_t count) {
+		const size_t offset = static_cast<size_t>(block - first) * sizeof(Underlying);
+		::Details::convertBytes<order, sizeof(Underlying)>(source + offset, reinterpret_cast<unsigned char*>(block), count);
+		return ::Details::findInvalidValue(block, count);
+	};
+
+	const auto blocks = range<Enum*>{first, first + std::ranges::size(values)} | views::chunks<blockSize>();
+	for(std::span<Enum, blockSize> block : blocks)
+	{
+		const size_t invalid = convertAndCheck(block.data(), blockSize);
+		if(invalid != blockSize)
+		{
+			return static_cast<size_t>(block.data() - first) + invalid;
+		}
+	}
+	const auto tail = blocks.remainder();
+	return static_cast<size_t>(tail.data() - first) + convertAndCheck(tail.data(), tail.size());
+}
+
+// The same conversions, for a byte order only known at runtime.
+template<::Details::contiguous_sized_range Range>
+void encode(const Range& values, std::byte* out, Endianess order) noexcept
+{
+	order == Endianess::big ? encode<Endianess::big>(values, out) : encode<Endianess::little>(values, out);
+}
+
+template<::Details::contiguous_sized_range Range>
+size_t decode(const std::byte* in, Range&& values, Endianess order) noexcept
+{
+	return order == Endianess::big ? decode<Endianess::big>(in, values) : decode<Endianess::little>(in, values);
+}
+
+}
+
+#endif // ENUM_SERIALIZATION_HXX
@@ -0,0 +1,493 @@
+#ifndef FIXED_STRING_MAP_HXX
+#define FIXED_STRING_MAP_HXX
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include <ConstexprAssert.hxx>
+#include <ConstString.hxx>
+#include <StaticString.hxx>
+#include <StringDetails.hxx>
+
+/* Hash map from short strings, of at most N characters, to T.
+ * The table is flat and open addressed, in the way of the Swiss tables : the keys, stored inline as StaticString<N>,
+ * the values and one control byte per slot live in three separate arrays. A control byte holds 7 bits of the hash
+ * of the key when the slot is full, or tells the slot is empty or deleted. Lookups test a group of 16 control bytes
+ * at once (with SSE2), and only compare the keys whose control byte matches, a word at a time since the keys are
+ * zero padded to their full capacity.
+ * Keys are given as ConstString, so string literals, StaticString and std::string can be used to look up the map
+ * without building a key first. Inserting a key longer than N characters is an error, while looking one up simply
+ * finds nothing.
+ *     FixedStringMap<16, int> map;
+ *     map["Foo"] = 4;
+ *     map.find(ConstString{"Foo"});
+ * Like the unordered standard containers, inserting may move every element, invalidating the iterators and references.
+ */
+
+namespace Details
+{
+
+class ControlGroup
+{
+public:
+	static constexpr size_t width = 16;
+
+	static constexpr int8_t empty = -128;
+	static constexpr int8_t deleted = -2;
+
+	explicit ControlGroup(const int8_t* control) noexcept : control_{control}
+	{}
+
+	// Bit i of the mask is set if the i-th control byte of the group is equal to hash.
+	uint32_t match(int8_t hash) const noexcept
+	{
+#if defined(__SSE2__) || defined(_M_X64)
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control_));
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(hash))));
+#else
+		uint32_t mask = 0;
+		for(size_t i = 0; i < width; ++i)
+		{
+			mask |= static_cast<uint32_t>(control_[i] == hash) << i;
+		}
+		return mask;
+#endif
+	}
+
+	uint32_t matchEmpty() const noexcept
+	{
+		return match(empty);
+	}
+
+	// Empty and deleted slots are the ones with the sign bit set.
+	uint32_t matchAvailable() const noexcept
+	{
+#if defined(__SSE2__) || defined(_M_X64)
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control_))));
+#else
+		uint32_t mask = 0;
+		for(size_t i = 0; i < width; ++i)
+		{
+			mask |= static_cast<uint32_t>(control_[i] < 0) << i;
+		}
+		return mask;
+#endif
+	}
+
+private:
+	const int8_t* control_;
+};
+
+}
+
+template<size_t N, class T>
+class FixedStringMap
+{
+	using Group = Details::ControlGroup;
+
+	template<bool isConst>
+	class Iterator
+	{
+		using MapType = std::conditional_t<isConst, const FixedStringMap, FixedStringMap>;
+		using ValueType = std::conditional_t<isConst, const T, T>;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::pair<const StaticString<N>, T>;
+		using difference_type = ptrdiff_t;
+		using reference = std::pair<const StaticString<N>&, ValueType&>;
+
+		struct pointer
+		{
+			const reference* operator->() const noexcept { return &ref; }
+
+			reference ref;
+		};
+
+		Iterator() noexcept : map_{nullptr}, slot_{0}
+		{}
+
+		Iterator(MapType& map, size_t slot) noexcept : map_{&map}, slot_{slot}
+		{
+			skipAvailable();
+		}
+
+		// Conversion from iterator to const_iterator.
+		template<bool otherConst, class = std::enable_if_t<isConst && !otherConst>>
+		Iterator(const Iterator<otherConst>& other) noexcept : map_{other.map_}, slot_{other.slot_}
+		{}
+
+		const StaticString<N>& key() const noexcept { return map_->keys_[slot_]; }
+		ValueType& value() const noexcept { return map_->values_[slot_]; }
+
+		reference operator*() const noexcept { return {key(), value()}; }
+		pointer operator->() const noexcept { return {**this}; }
+
+		Iterator& operator++() noexcept
+		{
+			++slot_;
+			skipAvailable();
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator tmp{*this};
+			++*this;
+			return tmp;
+		}
+
+		bool operator==(const Iterator& rhs) const noexcept
+		{
+			return slot_ == rhs.slot_;
+		}
+
+		bool operator!=(const Iterator& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+	private:
+		void skipAvailable() noexcept
+		{
+			while(slot_ < map_->capacity_ && map_->control_[slot_] < 0)
+			{
+				++slot_;
+			}
+		}
+
+		template<bool>
+		friend class Iterator;
+		friend class FixedStringMap;
+
+		MapType* map_;
+		size_t slot_;
+	};
+
+public:
+	using key_type = StaticString<N>;
+	using mapped_type = T;
+	using size_type = size_t;
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	FixedStringMap() noexcept : control_{nullptr}, keys_{nullptr}, values_{nullptr}, capacity_{0}, size_{0}, deleted_{0}
+	{}
+
+	explicit FixedStringMap(size_t count) : FixedStringMap{}
+	{
+		reserve(count);
+	}
+
+	FixedStringMap(const FixedStringMap& other) : FixedStringMap{}
+	{
+		reserve(other.size_);
+		for(auto it = other.begin(); it != other.end(); ++it)
+		{
+			emplaceUnique(it.key(), it.value());
+		}
+	}
+
+	FixedStringMap(FixedStringMap&& other) noexcept : FixedStringMap{}
+	{
+		swap(other);
+	}
+
+	FixedStringMap& operator=(FixedStringMap other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	~FixedStringMap()
+	{
+		release();
+	}
+
+	void swap(FixedStringMap& other) noexcept
+	{
+		std::swap(control_, other.control_);
+		std::swap(keys_, other.keys_);
+		std::swap(values_, other.values_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(size_, other.size_);
+		std::swap(deleted_, other.deleted_);
+	}
+
+	iterator begin() noexcept { return {*this, 0}; }
+	const_iterator begin() const noexcept { return {*this, 0}; }
+	const_iterator cbegin() const noexcept { return begin(); }
+
+	iterator end() noexcept { return {*this, capacity_}; }
+	const_iterator end() const noexcept { return {*this, capacity_}; }
+	const_iterator cend() const noexcept { return end(); }
+
+	size_t size() const noexcept { return size_; }
+	bool empty() const noexcept { return size_ == 0; }
+	size_t capacity() const noexcept { return capacity_; }
+
+	static constexpr size_t max_key_size() noexcept { return N; }
+
+	iterator find(ConstString key) noexcept
+	{
+		return {*this, findSlot(key)};
+	}
+
+	const_iterator find(ConstString key) const noexcept
+	{
+		return {*this, findSlot(key)};
+	}
+
+	bool contains(ConstString key) const noexcept
+	{
+		return findSlot(key) != capacity_;
+	}
+
+	// Insert a value built from args if the key is not in the map yet. The boolean tells whether it was inserted.
+	template<class ... Args>
+	std::pair<iterator, bool> try_emplace(ConstString key, Args&& ... args)
+	{
+		const size_t slot = findSlot(key);
+		if(slot != capacity_)
+		{
+			return {{*this, slot}, false};
+		}
+		return {{*this, emplaceUnique(key, std::forward<Args>(args)...)}, true};
+	}
+
+	template<class Value>
+	std::pair<iterator, bool> insert_or_assign(ConstString key, Value&& value)
+	{
+		auto result = try_emplace(key, std::forward<Value>(value));
+		if(!result.second)
+		{
+			result.first.value() = std::forward<Value>(value);
+		}
+		return result;
+	}
+
+	T& operator[](ConstString key)
+	{
+		return try_emplace(key).first.value();
+	}
+
+	// Number of elements removed, 0 or 1.
+	size_t erase(ConstString key)
+	{
+		const size_t slot = findSlot(key);
+		if(slot == capacity_)
+		{
+			return 0;
+		}
+		eraseSlot(slot);
+		return 1;
+	}
+
+	iterator erase(const_iterator position)
+	{
+		eraseSlot(position.slot_);
+		return {*this, position.slot_ + 1};
+	}
+
+	iterator erase(iterator position)
+	{
+		return erase(const_iterator{position});
+	}
+
+	void clear() noexcept
+	{
+		for(size_t slot = 0; slot < capacity_; ++slot)
+		{
+			if(control_[slot] >= 0)
+			{
+				std::destroy_at(values_ + slot);
+				keys_[slot] = {};
+			}
+			control_[slot] = Group::empty;
+		}
+		size_ = 0;
+		deleted_ = 0;
+	}
+
+	// Make room for count elements, so that inserting them does not rehash the table.
+	void reserve(size_t count)
+	{
+		size_t capacity = Group::width;
+		while(maxLoad(capacity) < count)
+		{
+			capacity *= 2;
+		}
+		if(capacity > capacity_)
+		{
+			rehash(capacity);
+		}
+	}
+
+private:
+	// Up to 7/8 of the slots can be used, full or deleted, so that probing always ends on an empty slot.
+	static constexpr size_t maxLoad(size_t capacity) noexcept
+	{
+		return capacity - capacity / 8;
+	}
+
+	static uint64_t hash(ConstString key) noexcept
+	{
+		return Details::hashBytes(key.data(), key.size());
+	}
+
+	// The low 7 bits of the hash go in the control byte, the others choose the first group to probe.
+	static int8_t controlHash(uint64_t hash) noexcept
+	{
+		return static_cast<int8_t>(hash & 0x7F);
+	}
+
+	size_t firstGroup(uint64_t hash) const noexcept
+	{
+		return (hash >> 7) & (capacity_ / Group::width - 1);
+	}
+
+	// Groups are probed in triangular order, which visits every one of them as their number is a power of 2.
+	size_t nextGroup(size_t group, size_t probe) const noexcept
+	{
+		return (group + probe) & (capacity_ / Group::width - 1);
+	}
+
+	size_t findSlot(ConstString key) const noexcept
+	{
+		if(size_ == 0 || key.size() > N)
+		{
+			return capacity_;
+		}
+
+		// The key is padded as the stored ones, so both can be compared over their whole capacity.
+		StaticString<N> padded;
+		padded.template append<TruncationPolicy::Truncate>(key);
+
+		const uint64_t keyHash = hash(key);
+		const int8_t control = controlHash(keyHash);
+		for(size_t group = firstGroup(keyHash), probe = 1; ; group = nextGroup(group, probe++))
+		{
+			const size_t first = group * Group::width;
+			const Group controls{control_.get() + first};
+			for(uint32_t mask = controls.match(control); mask != 0; mask &= mask - 1)
+			{
+				const size_t slot = first + static_cast<size_t>(std::countr_zero(mask));
+				if(keys_[slot].size() == padded.size() && Details::equalFixedBytes<N + 1>(keys_[slot].data(), padded.data()))
+				{
+					return slot;
+				}
+			}
+			if(controls.matchEmpty() != 0)
+			{
+				return capacity_;
+			}
+		}
+	}
+
+	// Insert a key known to be absent from the map.
+	template<class ... Args>
+	size_t emplaceUnique(ConstString key, Args&& ... args)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(key.size() <= N, "The key does not fit in the FixedStringMap !");
+		if(size_ + deleted_ >= maxLoad(capacity_))
+		{
+			// Rehashing at the same capacity is enough to get rid of the deleted slots when there are many of them.
+			rehash(size_ >= maxLoad(capacity_) / 2 ? std::max(capacity_ * 2, Group::width) : capacity_);
+		}
+
+		const uint64_t keyHash = hash(key);
+		const size_t slot = findAvailableSlot(keyHash);
+		std::construct_at(values_ + slot, std::forward<Args>(args)...);
+		deleted_ -= control_[slot] == Group::deleted;
+		control_[slot] = controlHash(keyHash);
+		keys_[slot].template append<TruncationPolicy::Truncate>(key);
+		++size_;
+		return slot;
+	}
+
+	size_t findAvailableSlot(uint64_t keyHash) const noexcept
+	{
+		for(size_t group = firstGroup(keyHash), probe = 1; ; group = nextGroup(group, probe++))
+		{
+			const size_t first = group * Group::width;
+			const uint32_t mask = Group{control_.get() + first}.matchAvailable();
+			if(mask != 0)
+			{
+				return first + static_cast<size_t>(std::countr_zero(mask));
+			}
+		}
+	}
+
+	void eraseSlot(size_t slot)
+	{
+		std::destroy_at(values_ + slot);
+		// Keys are kept zero padded, so that they can be compared over their whole capacity.
+		keys_[slot] = {};
+		// A slot can be emptied, rather than deleted, when its group was never full : no probe went past it.
+		const size_t first = slot - slot % Group::width;
+		const bool neverFull = Group{control_.get() + first}.matchEmpty() != 0;
+		control_[slot] = neverFull ? Group::empty : Group::deleted;
+		deleted_ += !neverFull;
+		--size_;
+	}
+
+	void rehash(size_t capacity)
+	{
+		FixedStringMap rehashed;
+		rehashed.allocate(capacity);
+		for(size_t slot = 0; slot < capacity_; ++slot)
+		{
+			if(control_[slot] >= 0)
+			{
+				const uint64_t keyHash = hash(keys_[slot]);
+				const size_t newSlot = rehashed.findAvailableSlot(keyHash);
+				std::construct_at(rehashed.values_ + newSlot, std::move(values_[slot]));
+				rehashed.control_[newSlot] = control_[slot];
+				rehashed.keys_[newSlot] = keys_[slot];
+				++rehashed.size_;
+			}
+		}
+		swap(rehashed);
+	}
+
+	void allocate(size_t capacity)
+	{
+		control_ = std::make_unique<int8_t[]>(capacity);
+		keys_ = std::make_unique<StaticString<N>[]>(capacity);
+		values_ = std::allocator<T>{}.allocate(capacity);
+		capacity_ = capacity;
+		for(size_t slot = 0; slot < capacity; ++slot)
+		{
+			control_[slot] = Group::empty;
+		}
+	}
+
+	void release() noexcept
+	{
+		if(values_ != nullptr)
+		{
+			clear();
+			std::allocator<T>{}.deallocate(values_, capacity_);
+		}
+	}
+
+	std::unique_ptr<int8_t[]> control_;
+	std::unique_ptr<StaticString<N>[]> keys_;
+	T* values_;
+	size_t capacity_;
+	size_t size_;
+	// Number of deleted slots, which still lengthen the probes until the next rehash.
+	size_t deleted_;
+};
+
+#endif // FIXED_STRING_MAP_HXX
@@ -2,14 +2,19 @@
 #define ENUM_UTILS_HXX
 
 #include <array>
+#include <compare>
 #include <iterator>
+#include <optional>
+#include <ranges>
 #include <tuple>
 #include <type_traits>
 
-#include <iostream>
 
+#include <EnumDecoratedNames.hxx>
+#include <EnumNameIndex.hxx>
 #include <MacroUtils.hxx>
 #include <StaticString.hxx>
+#include <StringHash.hxx>
 #include <Range.hxx>
 
 #define TRIM_ENUM_NAME
@@ -92,6 +97,23 @@ constexpr const StaticString<Tsize> stringifyTrimEnumInitializerHelper(ConstStri
     return stringifyEnumInitializerHelper<Tsize>(str).trim();
 }
 
+template<class Tuple, size_t ... indices>
+constexpr std::array<ConstString, sizeof...(indices)> makeNamesArray(const Tuple& names, std::index_sequence<indices...>) noexcept
+{
+    return {{ConstString{std::get<indices>(names)}...}};
+}
+
+template<size_t Tsize>
+constexpr std::array<uint64_t, Tsize> makeNameHashesArray(const std::array<ConstString, Tsize>& names) noexcept
+{
+    std::array<uint64_t, Tsize> hashes{};
+    for(size_t i = 0; i < Tsize; ++i)
+    {
+        hashes[i] = hashBytes(names[i].data(), names[i].size());
+    }
+    return hashes;
+}
+
 }
 
 #define STRINGIFY_ENUM_HELPER(string, stringType) stringType{STRINGIFY_ENUM_EQUAL_RANGE(string, stringType)}
@@ -114,60 +136,218 @@ namespace EnumUtils
  * Let's hope this got accepted in the next standard, this would cut a lot of verbose in this code.
  */
 
-/* NOTE : The operator-> reintepret_cast is safe, as the class EnumName will contain only a EnumName::Internal##EnumName value anyway.
- * The other members are static constexpr variables, or member functions.
- */
-
 enum class EnumIteratorTag : uint8_t
 {
     Normal,
     Reversed
 };
 
+/* The enumerators of EnumName, as EnumName, in the order of their declaration : the array returned by
+ * EnumName::enumerators(), which the iterators refer to. Unlike reinterpreting the array of values() as an array of
+ * EnumName, it can be used in constant expressions. It is built from values computed at compile time, so that the
+ * array of values() is only stored when it is used at runtime.
+ */
+template<class EnumName>
+class Enumerators
+{
+    static constexpr std::array<EnumName, EnumName::size()> build() noexcept
+    {
+        constexpr auto values = EnumName::internal_values();
+        std::array<EnumName, EnumName::size()> enumerators{};
+        for(size_t index = 0; index < enumerators.size(); ++index)
+        {
+            enumerators[index] = EnumName{values[index]};
+        }
+        return enumerators;
+    }
+    
+    public:
+    static constexpr std::array<EnumName, EnumName::size()> values_ = build();
+};
+
+/* The iterator is a single pointer in the static array of enumerators, so that iterating over an enum compiles to the
+ * same code as a loop over the array of values. A reversed iterator points one past the element it refers to.
+ */
 template<class EnumName, EnumIteratorTag tag>
-class EnumIterator : public std::conditional_t<tag == EnumIteratorTag::Normal,
-                                                typename ArrayIteratorPolicy<typename EnumName::ValuesArrayType>::const_iterator,
-                                                typename ArrayIteratorPolicy<typename EnumName::ValuesArrayType>::const_reverse_iterator>
+class EnumIterator
 {
+    using ValuePointer = const EnumName*;
+    static constexpr bool reversed = tag == EnumIteratorTag::Reversed;
+    static constexpr EnumIteratorTag otherTag = reversed ? EnumIteratorTag::Normal : EnumIteratorTag::Reversed;
+    
     public:
+    using value_type = EnumName;
     using pointer = const EnumName*;
     using reference = const EnumName&;
-    
-    using Base = std::conditional_t<tag == EnumIteratorTag::Normal,
-                                                typename ArrayIteratorPolicy<typename EnumName::ValuesArrayType>::const_iterator,
-                                                typename ArrayIteratorPolicy<typename EnumName::ValuesArrayType>::const_reverse_iterator>;
+    using difference_type = ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
                                                 
     friend EnumName;
+    friend EnumIterator<EnumName, otherTag>;
     
     protected:
     struct indexInitFlag{};
          
-    constexpr EnumIterator(typename Base::IndexType index, indexInitFlag) : Base{EnumName::values(), index}
+    constexpr EnumIterator(size_t index, indexInitFlag) noexcept : ptr_{Enumerators<EnumName>::values_.data() + index}
     {}
     
     public:
-    using Base::Base;
+    constexpr EnumIterator() noexcept : ptr_{Enumerators<EnumName>::values_.data()}
+    {}
     
-    constexpr EnumIterator(EnumName e) : Base{EnumName::values(), e.get_index()}
+    constexpr EnumIterator(EnumName e) noexcept : ptr_{find(e)}
+    {}
+    
+    // A reversed iterator built from a normal one refers to the element before it, as std::reverse_iterator does.
+    constexpr EnumIterator(const EnumIterator<EnumName, otherTag>& other) noexcept : ptr_{other.ptr_}
     {}
     
     constexpr EnumIterator(const EnumIterator& other) = default;
     
     constexpr EnumIterator& operator=(const EnumIterator& other) = default;
     
-    constexpr reference operator*() const
+    constexpr reference operator*() const noexcept
+    {
+        if constexpr(reversed)
+        {
+            return ptr_[-1];
+        }
+        return *ptr_;
+    }
+    
+    constexpr pointer operator->() const noexcept
+    {
+        return &**this;
+    }
+    
+    constexpr reference operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+    
+    constexpr EnumIterator& operator++() noexcept
+    {
+        return *this += 1;
+    }
+    
+    constexpr EnumIterator operator++(int) noexcept
+    {
+        EnumIterator tmp{*this};
+        *this += 1;
+        return tmp;
+    }
+    
+    constexpr EnumIterator& operator--() noexcept
+    {
+        return *this -= 1;
+    }
+    
+    constexpr EnumIterator operator--(int) noexcept
+    {
+        EnumIterator tmp{*this};
+        *this -= 1;
+        return tmp;
+    }
+    
+    constexpr EnumIterator& operator+=(difference_type n) noexcept
+    {
+        ptr_ += reversed ? -n : n;
+        return *this;
+    }
+    
+    constexpr EnumIterator& operator-=(difference_type n) noexcept
+    {
+        ptr_ -= reversed ? -n : n;
+        return *this;
+    }
+    
+    constexpr EnumIterator operator+(difference_type n) const noexcept
+    {
+        EnumIterator tmp{*this};
+        return tmp += n;
+    }
+    
+    friend constexpr EnumIterator operator+(difference_type n, const EnumIterator& it) noexcept
+    {
+        return it + n;
+    }
+    
+    constexpr EnumIterator operator-(difference_type n) const noexcept
+    {
+        EnumIterator tmp{*this};
+        return tmp -= n;
+    }
+    
+    constexpr difference_type operator-(const EnumIterator& rhs) const noexcept
     {
-        return reinterpret_cast<reference>(Base::operator*());
+        return reversed ? rhs.ptr_ - ptr_ : ptr_ - rhs.ptr_;
     }
     
-    constexpr pointer operator->() const
+    constexpr bool operator==(const EnumIterator& rhs) const noexcept
     {
-        return reinterpret_cast<pointer>(Base::operator->());
+        return ptr_ == rhs.ptr_;
     }
+    
+    constexpr std::strong_ordering operator<=>(const EnumIterator& rhs) const noexcept
+    {
+        return reversed ? rhs.ptr_ <=> ptr_ : ptr_ <=> rhs.ptr_;
+    }
+    
+    private:
+    // The same as get_index, but searching the array of enumerators, so that only this array is used by the iteration.
+    static constexpr ValuePointer find(EnumName e) noexcept
+    {
+        const ValuePointer first = Enumerators<EnumName>::values_.data();
+        if constexpr(EnumName::is_contiguous())
+        {
+            return first + e.get_index();
+        }
+        ValuePointer it = first;
+        while(it != first + EnumName::size() && *it != e)
+        {
+            ++it;
+        }
+        return it;
+    }
+    
+    ValuePointer ptr_;
 };
 
+
+// Base of the ranges returned by EnumName::iter(), marking them as borrowed ranges.
+struct iterable_base
+{};
+
+// True for the classes declared by ITERABLE_ENUM and IMPROVED_ENUM.
+template<class T, class = void>
+struct is_iterable_enum : std::false_type
+{};
+
+template<class T>
+struct is_iterable_enum<T, Meta::void_t<typename T::UnderlyingEnumType, typename T::ValuesArrayType>> : std::true_type
+{};
+
 }
 
+// The ranges returned by EnumName::iter() can be given as temporaries to the std::ranges algorithms.
+template<class T>
+requires std::derived_from<T, EnumUtils::iterable_base>
+inline constexpr bool std::ranges::enable_borrowed_range<T> = true;
+
+/* The hash of an enumerator is its value : the values are distinct by construction, and usually small and
+ * dense, which is what the standard unordered containers handle best.
+ */
+template<class EnumName>
+requires EnumUtils::is_iterable_enum<EnumName>::value
+struct std::hash<EnumName>
+{
+    constexpr size_t operator()(EnumName e) const noexcept
+    {
+        return static_cast<size_t>(e.to_value());
+    }
+};
+
 #define ITERABLE_ENUM(EnumName, underlyingType, ...)                                                                            \
 static_assert(std::is_integral<underlyingType>::value,                                                                          \
     "The defined underlying type is not an integral type");                                                                     \
@@ -184,11 +364,20 @@ class EnumName
     using UnderlyingEnumType = Internal##EnumName;                                                                              \
     using TupleType = std::tuple<MAP2(ENUM_NAME_TUPLE_DECL, __VA_ARGS__)>;                                                      \
                                                                                                                                 \
+    private:                                                                                                                    \
+    friend EnumUtils::Enumerators<EnumName>;                                                                                    \
+    /* Only evaluated at compile time, to build the array of enumerators. Defined first, to be usable in constant */            \
+    /* expressions from the bodies of the members below. */                                                                     \
+    static constexpr std::array<Internal##EnumName, std::tuple_size<TupleType>::value> internal_values() noexcept               \
+    {                                                                                                                           \
+        return {{MAP2(ENUM_ASSIGN_REMOVE(EnumName), __VA_ARGS__)}};                                                             \
+    }                                                                                                                           \
+                                                                                                                                \
     public:                                                                                                                     \
-    constexpr EnumName() noexcept : value_{values_[0]} {}                                                                       \
-    constexpr EnumName(const EnumName& other) noexcept : value_{other.value_} {}                                                \
+    constexpr EnumName() noexcept : value_{internal_values()[0]} {}                                                             \
+    constexpr EnumName(const EnumName&) noexcept = default;                                                                     \
     constexpr EnumName(Internal##EnumName value) noexcept : value_{value} {}                                                    \
-    constexpr EnumName operator=(const EnumName& other) noexcept { value_ = other.value_; return *this; }                       \
+    constexpr EnumName& operator=(const EnumName&) noexcept = default;                                                          \
     constexpr EnumName operator=(Internal##EnumName value) noexcept { value_ = value; return *this; }                           \
                                                                                                                                 \
     constexpr bool operator==(EnumName other) const noexcept { return value_ == other.value_; }                                 \
@@ -207,26 +396,36 @@ class EnumName
         return to_value();                                                                                                      \
     }                                                                                                                           \
     template<class T>                                                                                                           \
-    static constexpr EnumName from_value(T val)                                                                                 \
+    static constexpr std::optional<EnumName> try_from_value(T val) noexcept                                                     \
     {                                                                                                                           \
         static_assert(std::is_convertible<T, underlying_type>::value,                                                           \
         "Construction from value require the value to be convertible to the underlying type");                                  \
                                                                                                                                 \
-        for(const auto value : values_)                                                                                         \
+        for(const auto value : enumerators())                                                                                   \
         {                                                                                                                       \
-            if(value == val)                                                                                                    \
+            if(value == static_cast<Internal##EnumName>(val))                                                                   \
             {                                                                                                                   \
-                return {static_cast<Internal##EnumName>(val)};                                                                  \
+                return EnumName{static_cast<Internal##EnumName>(val)};                                                          \
             }                                                                                                                   \
         }                                                                                                                       \
-                                                                                                                                \
-        CONSTEXPR_ASSERT(false, "The value to build from is invalid");                                                          \
+        return std::nullopt;                                                                                                    \
+    }                                                                                                                           \
+    template<class T>                                                                                                           \
+    static constexpr EnumName from_value(T val)                                                                                 \
+    {                                                                                                                           \
+        const std::optional<EnumName> result = try_from_value(val);                                                             \
+        if(!result)                                                                                                             \
+        {                                                                                                                       \
+            CONSTEXPR_FAIL("The value to build from is invalid");                                                               \
+        }                                                                                                                       \
+        return *result;                                                                                                         \
     }                                                                                                                           \
 	static constexpr bool is_contiguous() noexcept 																				\
 	{ 																															\
-		if(values_.size() == 0) return true; 																					\
-		underlyingType last = values_[0];																						\
-		for(auto it = values_.cbegin() + 1; it != values_.cend(); ++it, ++last)												    \
+		const auto values = internal_values();																					\
+		if(values.size() == 0) return true;																						\
+		underlyingType last = values[0];																						\
+		for(auto it = values.cbegin() + 1; it != values.cend(); ++it, ++last)													\
 		{																														\
 			if(*it != last + 1) return false;																					\
 		}																														\
@@ -239,22 +438,23 @@ class EnumName
     }                                                                                                                           \
                                                                                                                                 \
     private:                                                                                                                    \
-    class IterableHelper                                                                                                        \
+    /* The iterators only refer to the static array of enumerators, so they can outlive the IterableHelper. */                  \
+    class IterableHelper : public EnumUtils::iterable_base                                                                      \
     {                                                                                                                           \
         public:                                                                                                                 \
-        constexpr IterableHelper() : value_{values_[0]}{}                                                                       \
-        constexpr IterableHelper(Internal##EnumName value) : value_{value}{}                                                    \
+        constexpr IterableHelper() : first_{}{}                                                                                 \
+        constexpr IterableHelper(Internal##EnumName value) : first_{EnumName{value}}{}                                          \
                                                                                                                                 \
                                                                                                                                 \
-        constexpr EnumName::iterator begin() noexcept { return { value_ }; }                                                    \
-        constexpr EnumName::const_iterator cbegin() noexcept { return begin(); }                                                \
-        constexpr EnumName::iterator end() noexcept { return { size_, EnumName::iterator::indexInitFlag{} }; }                  \
-        constexpr EnumName::const_iterator cend() noexcept { return end(); }                                                    \
+        constexpr EnumName::iterator begin() const noexcept { return first_; }                                                  \
+        constexpr EnumName::const_iterator cbegin() const noexcept { return begin(); }                                          \
+        constexpr EnumName::iterator end() const noexcept { return { size_, EnumName::iterator::indexInitFlag{} }; }            \
+        constexpr EnumName::const_iterator cend() const noexcept { return end(); }                                              \
                                                                                                                                 \
-        constexpr EnumName::reverse_iterator rbegin() noexcept { return end(); }                                                \
-        constexpr EnumName::const_reverse_iterator crbegin() noexcept { return end(); }                                         \
-        constexpr EnumName::reverse_iterator rend() noexcept { return begin(); }                                                \
-        constexpr EnumName::const_reverse_iterator crend() noexcept { return begin(); }                                         \
+        constexpr EnumName::reverse_iterator rbegin() const noexcept { return end(); }                                          \
+        constexpr EnumName::const_reverse_iterator crbegin() const noexcept { return end(); }                                   \
+        constexpr EnumName::reverse_iterator rend() const noexcept { return begin(); }                                          \
+        constexpr EnumName::const_reverse_iterator crend() const noexcept { return begin(); }                                   \
                                                                                                                                 \
         static constexpr EnumName::iterator from(EnumName e) noexcept { return { e }; }                                         \
         static constexpr EnumName::const_iterator cfrom(EnumName e) noexcept { return { e }; }                                  \
@@ -262,7 +462,7 @@ class EnumName
         static constexpr EnumName::const_reverse_iterator crfrom(EnumName e) noexcept { return { e }; }                         \
                                                                                                                                 \
         private:                                                                                                                \
-        Internal##EnumName value_;                                                                                              \
+        EnumName::iterator first_;                                                                                              \
     };                                                                                                                          \
                                                                                                                                 \
     public:                                                                                                                     \
@@ -271,9 +471,18 @@ class EnumName
                                                                                                                                 \
     constexpr size_t get_index() const noexcept                                                                                 \
     {                                                                                                                           \
+        if constexpr(is_contiguous())                                                                                           \
+        {                                                                                                                       \
+            /* Values outside of the enumeration fall past the last index, and get size_ as in the search below. */             \
+            /* Subtracted unsigned, as the difference may not fit in the underlying type. */                                    \
+            using unsignedType = std::make_unsigned_t<underlyingType>;                                                          \
+            const size_t index = static_cast<size_t>(static_cast<unsignedType>(static_cast<unsignedType>(value_)                \
+                                                     - static_cast<unsignedType>(enumerators()[0].value_)));                    \
+            return index < size_ ? index : size_;                                                                               \
+        }                                                                                                                       \
         for(size_t i = 0; i < size_; ++i)                                                                                       \
         {                                                                                                                       \
-            if(values_[i] == value_) return i;                                                                                  \
+            if(enumerators()[i].value_ == value_) return i;                                                                     \
         }                                                                                                                       \
         return size_; /* Or error ? */                                                                                          \
     }                                                                                                                           \
@@ -289,8 +498,12 @@ class EnumName
                                                                                                                                 \
     public:                                                                                                                     \
     using ValuesArrayType = std::array<Internal##EnumName, size_>;                                                              \
+    /* The enumerators as EnumName, the array the iterators point in. The members use it rather than values(), so that */       \
+    /* the values are only stored once unless values() is used at runtime. */                                                   \
+    using EnumeratorsArrayType = std::array<EnumName, size_>;                                                                   \
                                                                                                                                 \
     static constexpr const ValuesArrayType& values() noexcept { return values_; }                                               \
+    static constexpr const EnumeratorsArrayType& enumerators() noexcept { return EnumUtils::Enumerators<EnumName>::values_; }   \
                                                                                                                                 \
     private:                                                                                                                    \
     static constexpr ValuesArrayType values_{{MAP2(ENUM_ASSIGN_REMOVE(EnumName), __VA_ARGS__)}};                                \
@@ -302,8 +515,8 @@ class EnumName
  */
 
 #define IMPROVED_ENUM(EnumName, underlyingType, ...)                                                                            \
-namespace { using EnumName##TupleType = std::tuple<MAP2(ENUM_NAME_TUPLE_DECL, __VA_ARGS__)>;                                    \
-static constexpr EnumName##TupleType EnumName##names_{MAP2(STRINGIFY_ENUM, __VA_ARGS__)};}                                      \
+using EnumName##TupleType = std::tuple<MAP2(ENUM_NAME_TUPLE_DECL, __VA_ARGS__)>;                                                \
+inline constexpr EnumName##TupleType EnumName##names_{MAP2(STRINGIFY_ENUM, __VA_ARGS__)};                                       \
 static_assert(std::is_integral<underlyingType>::value,                                                                          \
     "The defined underlying type is not an integral type");                                                                     \
 class EnumName                                                                                                                  \
@@ -318,11 +531,20 @@ class EnumName
     using underlying_type = underlyingType;                                                                                     \
     using UnderlyingEnumType = Internal##EnumName;                                                                              \
                                                                                                                                 \
+    private:                                                                                                                    \
+    friend EnumUtils::Enumerators<EnumName>;                                                                                    \
+    /* Only evaluated at compile time, to build the array of enumerators. Defined first, to be usable in constant */            \
+    /* expressions from the bodies of the members below. */                                                                     \
+    static constexpr std::array<Internal##EnumName, std::tuple_size<EnumName##TupleType>::value> internal_values() noexcept     \
+    {                                                                                                                           \
+        return {{MAP2(ENUM_ASSIGN_REMOVE(EnumName), __VA_ARGS__)}};                                                             \
+    }                                                                                                                           \
+                                                                                                                                \
     public:                                                                                                                     \
-    constexpr EnumName() noexcept : value_{values_[0]} {}                                                                       \
-    constexpr EnumName(const EnumName& other) noexcept : value_{other.value_} {}                                                \
+    constexpr EnumName() noexcept : value_{internal_values()[0]} {}                                                             \
+    constexpr EnumName(const EnumName&) noexcept = default;                                                                     \
     constexpr EnumName(Internal##EnumName value) noexcept : value_{value} {}                                                    \
-    constexpr EnumName operator=(const EnumName& other) noexcept { value_ = other.value_; return *this; }                       \
+    constexpr EnumName& operator=(const EnumName&) noexcept = default;                                                          \
     constexpr EnumName operator=(Internal##EnumName value) noexcept { value_ = value; return *this; }                           \
                                                                                                                                 \
     constexpr bool operator==(EnumName other) const noexcept { return value_ == other.value_; }                                 \
@@ -341,27 +563,37 @@ class EnumName
         return to_value();                                                                                                      \
     }                                                                                                                           \
     template<class T>                                                                                                           \
-    static constexpr EnumName from_value(T val) noexcept                                                                        \
+    static constexpr std::optional<EnumName> try_from_value(T val) noexcept                                                     \
     {                                                                                                                           \
         static_assert(std::is_convertible<T, underlying_type>::value,                                                           \
         "Construction from value require the value to be convertible to the underlying type");                                  \
                                                                                                                                 \
-        for(const auto value : values_)                                                                                         \
+        for(const auto value : enumerators())                                                                                   \
         {                                                                                                                       \
             if(value == static_cast<Internal##EnumName>(val))                                                                   \
             {                                                                                                                   \
-                return {static_cast<Internal##EnumName>(val)};                                                                  \
+                return EnumName{static_cast<Internal##EnumName>(val)};                                                          \
             }                                                                                                                   \
         }                                                                                                                       \
-                                                                                                                                \
-        CONSTEXPR_ASSERT(false, "The value to build from is invalid");                                                          \
+        return std::nullopt;                                                                                                    \
+    }                                                                                                                           \
+    template<class T>                                                                                                           \
+    static constexpr EnumName from_value(T val) noexcept                                                                        \
+    {                                                                                                                           \
+        const std::optional<EnumName> result = try_from_value(val);                                                             \
+        if(!result)                                                                                                             \
+        {                                                                                                                       \
+            CONSTEXPR_FAIL("The value to build from is invalid");                                                               \
+        }                                                                                                                       \
+        return *result;                                                                                                         \
     }                                                                                                                           \
                                                                                                                                 \
 	static constexpr bool is_contiguous() noexcept		 																		\
 	{ 																															\
-		if(values_.size() == 0) return true; 																					\
-		underlyingType last = values_[0];																						\
-		for(auto it = values_.cbegin() + 1; it != values_.cend(); ++it, ++last)												    \
+		const auto values = internal_values();																					\
+		if(values.size() == 0) return true;																						\
+		underlyingType last = values[0];																						\
+		for(auto it = values.cbegin() + 1; it != values.cend(); ++it, ++last)													\
 		{																														\
 			if(*it != last + 1) return false;																					\
 		}																														\
@@ -374,22 +606,23 @@ class EnumName
     }                                                                                                                           \
                                                                                                                                 \
     private:                                                                                                                    \
-    class IterableHelper                                                                                                        \
+    /* The iterators only refer to the static array of enumerators, so they can outlive the IterableHelper. */                  \
+    class IterableHelper : public EnumUtils::iterable_base                                                                      \
     {                                                                                                                           \
         public:                                                                                                                 \
-        constexpr IterableHelper() : value_{values_[0]}{}                                                                       \
-        constexpr IterableHelper(Internal##EnumName value) : value_{value}{}                                                    \
+        constexpr IterableHelper() : first_{}{}                                                                                 \
+        constexpr IterableHelper(Internal##EnumName value) : first_{EnumName{value}}{}                                          \
                                                                                                                                 \
                                                                                                                                 \
-        constexpr EnumName::iterator begin() noexcept { return { value_ }; }                                                    \
-        constexpr EnumName::const_iterator cbegin() noexcept { return begin(); }                                                \
-        constexpr EnumName::iterator end() noexcept { return { size_, EnumName::iterator::indexInitFlag{} }; }                  \
-        constexpr EnumName::const_iterator cend() noexcept { return end(); }                                                    \
+        constexpr EnumName::iterator begin() const noexcept { return first_; }                                                  \
+        constexpr EnumName::const_iterator cbegin() const noexcept { return begin(); }                                          \
+        constexpr EnumName::iterator end() const noexcept { return { size_, EnumName::iterator::indexInitFlag{} }; }            \
+        constexpr EnumName::const_iterator cend() const noexcept { return end(); }                                              \
                                                                                                                                 \
-        constexpr EnumName::reverse_iterator rbegin() noexcept { return end(); }                                                \
-        constexpr EnumName::const_reverse_iterator crbegin() noexcept { return end(); }                                         \
-        constexpr EnumName::reverse_iterator rend() noexcept { return begin(); }                                                \
-        constexpr EnumName::const_reverse_iterator crend() noexcept { return begin(); }                                         \
+        constexpr EnumName::reverse_iterator rbegin() const noexcept { return end(); }                                          \
+        constexpr EnumName::const_reverse_iterator crbegin() const noexcept { return end(); }                                   \
+        constexpr EnumName::reverse_iterator rend() const noexcept { return begin(); }                                          \
+        constexpr EnumName::const_reverse_iterator crend() const noexcept { return begin(); }                                   \
                                                                                                                                 \
         static constexpr EnumName::iterator from(EnumName e) noexcept { return { e }; }                                         \
         static constexpr EnumName::const_iterator cfrom(EnumName e) noexcept { return { e }; }                                  \
@@ -397,7 +630,7 @@ class EnumName
         static constexpr EnumName::const_reverse_iterator crfrom(EnumName e) noexcept { return { e }; }                         \
                                                                                                                                 \
         private:                                                                                                                \
-        Internal##EnumName value_;                                                                                              \
+        EnumName::iterator first_;                                                                                              \
     };                                                                                                                          \
                                                                                                                                 \
     public:                                                                                                                     \
@@ -406,9 +639,18 @@ class EnumName
                                                                                                                                 \
     constexpr size_t get_index() const noexcept                                                                                 \
     {                                                                                                                           \
+        if constexpr(is_contiguous())                                                                                           \
+        {                                                                                                                       \
+            /* Values outside of the enumeration fall past the last index, and get size_ as in the search below. */             \
+            /* Subtracted unsigned, as the difference may not fit in the underlying type. */                                    \
+            using unsignedType = std::make_unsigned_t<underlyingType>;                                                          \
+            const size_t index = static_cast<size_t>(static_cast<unsignedType>(static_cast<unsignedType>(value_)                \
+                                                     - static_cast<unsignedType>(enumerators()[0].value_)));                    \
+            return index < size_ ? index : size_;                                                                               \
+        }                                                                                                                       \
         for(size_t i = 0; i < size_; ++i)                                                                                       \
         {                                                                                                                       \
-            if(values_[i] == value_) return i;                                                                                  \
+            if(enumerators()[i].value_ == value_) return i;                                                                     \
         }                                                                                                                       \
         return size_; /* Or error ? */                                                                                          \
     }                                                                                                                           \
@@ -417,9 +659,31 @@ class EnumName
                                                                                                                                 \
     public:                                                                                                                     \
     constexpr ConstString to_string() const;                                                                                    \
+    constexpr ConstString to_qualified_string() const;                                                                          \
+    constexpr ConstString to_debug_string() const;                                                                              \
     static constexpr ConstString get_enum_name() noexcept                                                                       \
     {                                                                                                                           \
         return #EnumName;                                                                     		                            \
+    }                                                                                                                           \
+    static constexpr EnumUtils::PrefixMatch<EnumName> match_prefix(ConstString prefix) noexcept                                 \
+    {                                                                                                                           \
+        return EnumUtils::NameIndex<EnumName>::match_prefix(prefix);                                                            \
+    }                                                                                                                           \
+    template<EnumUtils::StringCase sensitivity = EnumUtils::StringCase::Sensitive>                                              \
+    static constexpr EnumName from_string(ConstString name) noexcept                                                            \
+    {                                                                                                                           \
+        const EnumName* value = EnumUtils::NameIndex<EnumName>::template find<sensitivity>(name);                               \
+        if(value == nullptr)                                                                                                    \
+        {                                                                                                                       \
+            CONSTEXPR_FAIL("The name to build from is invalid");                                                                \
+        }                                                                                                                       \
+        return *value;                                                                                                          \
+    }                                                                                                                           \
+    template<EnumUtils::StringCase sensitivity = EnumUtils::StringCase::Sensitive>                                              \
+    static constexpr std::optional<EnumName> try_from_string(ConstString name) noexcept                                         \
+    {                                                                                                                           \
+        const EnumName* value = EnumUtils::NameIndex<EnumName>::template find<sensitivity>(name);                               \
+        return value != nullptr ? std::optional<EnumName>{*value} : std::nullopt;                                               \
     }                                                                                                                           \
                                                                                                                                 \
     private:                                                                                                                    \
@@ -433,7 +697,7 @@ class EnumName
         {                                                                                                                       \
             static_assert(index < e.size_, "Out of range !");                                                                   \
                                                                                                                                 \
-            return e.values_[index] == e.value_ ?                                                                               \
+            return enumerators()[index].value_ == e.value_ ?                                                                    \
             ConstString{std::get<index>(EnumName##names_)}                                                                      \
             : Looper<index + 1>::to_string_impl(e);                                                                             \
         }                                                                                                                       \
@@ -441,10 +705,20 @@ class EnumName
                                                                                                                                 \
     public:                                                                                                                     \
     using ValuesArrayType = std::array<Internal##EnumName, size_>;                                                              \
+    /* The enumerators as EnumName, the array the iterators point in. The members use it rather than values(), so that */       \
+    /* the values are only stored once unless values() is used at runtime. */                                                   \
+    using EnumeratorsArrayType = std::array<EnumName, size_>;                                                                   \
     static constexpr const ValuesArrayType& values() noexcept { return values_; }                                               \
+    static constexpr const EnumeratorsArrayType& enumerators() noexcept { return EnumUtils::Enumerators<EnumName>::values_; }   \
+    using NamesArrayType = std::array<ConstString, size_>;                                                                      \
+    static constexpr const NamesArrayType& names() noexcept { return names_; }                                                  \
+    using NameHashesArrayType = std::array<uint64_t, size_>;                                                                    \
+    static constexpr const NameHashesArrayType& name_hashes() noexcept { return name_hashes_; }                                 \
                                                                                                                                 \
     private:                                                                                                                    \
-    static constexpr ValuesArrayType values_{{MAP2(ENUM_ASSIGN_REMOVE(EnumName), __VA_ARGS__)}};                             	\
+    static constexpr ValuesArrayType values_{{MAP2(ENUM_ASSIGN_REMOVE(EnumName), __VA_ARGS__)}};                                \
+    static constexpr NamesArrayType names_ = Details::makeNamesArray(EnumName##names_, std::make_index_sequence<size_>{});      \
+    static constexpr NameHashesArrayType name_hashes_ = Details::makeNameHashesArray(names_);                                   \
 };                                                                                                                              \
                                                                                                                                 \
 template<>                                                                                                                      \
@@ -459,6 +733,17 @@ constexpr ConstString EnumName::to_string() const
 {                                                                                                                               \
     return Looper<0>::to_string_impl(*this);                                                                                    \
 }                                                                                                                               \
+constexpr ConstString EnumName::to_qualified_string() const                                                                     \
+{                                                                                                                               \
+    /* Empty for the values outside of the enumeration, as to_string(). */                                                      \
+    const size_t index = get_index();                                                                                           \
+    return index < size_ ? EnumUtils::DecoratedNames<EnumName>::qualified_[index] : ConstString{""};                            \
+}                                                                                                                               \
+constexpr ConstString EnumName::to_debug_string() const                                                                         \
+{                                                                                                                               \
+    const size_t index = get_index();                                                                                           \
+    return index < size_ ? EnumUtils::DecoratedNames<EnumName>::debug_[index] : ConstString{""};                                \
+}                                                                                                                               \
                                                                
 #endif // ENUM_UTILS_HXX
 
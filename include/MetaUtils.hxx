@@ -1,6 +1,9 @@
 #ifndef META_UTILS_HXX
 #define META_UTILS_HXX
 
+#include <cstdint>
+#include <type_traits>
+
 #include <Configuration.hxx>
 
 // Some metaprogramming utilities, reduced to the bare minimum for the library.
@@ -40,6 +43,12 @@ struct is_iterator_of<T, Iterator, void> : std::conditional_t<
 									std::true_type, std::false_type>
 {};
 
+// Smallest unsigned type able to hold max, used for the sizes of the fixed capacity containers.
+template<size_t max>
+using smallest_unsigned_t = std::conditional_t<(max <= UINT8_MAX), uint8_t,
+                            std::conditional_t<(max <= UINT16_MAX), uint16_t,
+                            std::conditional_t<(max <= UINT32_MAX), uint32_t, size_t>>>;
+
 template<size_type ... N>
 using index_sequence = std::integer_sequence<size_type, N...>;
 
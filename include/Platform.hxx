@@ -32,7 +32,10 @@
 #   define FUNCTION __PRETTY_FUNCTION__
 #   define restrict __restrict__
 #   if __has_attribute(always_inline)
-#       define force_inline __atribute__((always_inline))
+#       define force_inline __attribute__((always_inline))
+#   endif
+#   if __has_attribute(cold) && __has_attribute(noinline)
+#       define cold_noinline __attribute__((cold, noinline))
 #   endif
 #   if __has_builtin(__builtin_expect)
 #       define likely(x)    __builtin_expect((x), 1)
@@ -63,6 +66,7 @@
 #   define FUNCTION __PRETTY_FUNCTION__
 #	define restrict __restrict__
 #	define force_inline __attribute__((always_inline))
+#	define cold_noinline __attribute__((cold, noinline))
 #	define likely(x)    __builtin_expect((x),1)
 #	define unlikely(x)  __builtin_expect((x),0)
 #   if defined( __MINGW__ )
@@ -93,6 +97,7 @@
 #   define FUNCTION __FUNCSIG__
 #	define restrict __declspec(restrict)
 #	define force_inline __forceinline
+#	define cold_noinline __declspec(noinline)
 #	define likely(x)
 #	define unlikely(x)
 #   define COMPILE_NAME "Microsoft compiler"
@@ -170,6 +175,11 @@
 #   warning The 'force_inline' specifier is not supported. It is disabled, and will have no effect if used !
 #endif
 
+/* Only a hint for the failure paths, so no warning */
+#if !defined( cold_noinline )
+#   define cold_noinline
+#endif
+
 /* Assume if one of those is not defined, the other must not be so */
 #if !defined( likely ) || !defined( unlikely )
 #   define likely(x)
@@ -228,6 +238,22 @@
 #   define PLATFORM_X86
 #endif
 
+/* Runtime CPU dispatch. On x86, a function can be compiled for an instruction set the build does not target, by
+ * marking it target_feature("avx2") for instance, and called once cpuFeatures() (CpuFeatures.hxx) reported the set
+ * as supported : the binary stays portable, and still uses the best instructions of the machine it runs on.
+ * MSVC needs no attribute to use the intrinsics.
+ */
+#if( COMPILER == GCC_COMPILER || COMPILER == CLANG_COMPILER ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#   define CPU_DISPATCH 1
+#   define target_feature(features) __attribute__((target(features)))
+#elif( COMPILER == MSVC_COMPILER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#   define CPU_DISPATCH 1
+#   define target_feature(features)
+#else
+#   define CPU_DISPATCH 0
+#   define target_feature(features)
+#endif
+
 #if defined(_DEBUG) || !defined(NDEBUG)
 #	define DEBUG true
 #else
@@ -5,32 +5,17 @@
 #ifndef RANGE_HXX
 #define RANGE_HXX
 
+#include <concepts>
 #include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
 
 #include <ConstexprAssert.hxx>
 #include <MetaUtils.hxx>
 
 namespace Details
 {
-    template<class Iterator,
-             std::enable_if_t<std::is_same<typename std::iterator_traits<Iterator>::iterator_category,
-                              std::random_access_iterator_tag>::value>* = nullptr>
-    constexpr auto difference(Iterator first, Iterator last)
-    -> typename std::iterator_traits<Iterator>::difference_type
-    {
-        return last - first;
-    }
-    
-    template<class Iterator,
-             std::enable_if_t<!std::is_same<typename std::iterator_traits<Iterator>::iterator_category,
-                              std::random_access_iterator_tag>::value>* = nullptr>
-    constexpr auto difference(Iterator first, Iterator last)
-    -> typename std::iterator_traits<Iterator>::difference_type
-    {
-        typename std::iterator_traits<Iterator>::difference_type i = 0;
-        for(auto it = first; it != last; ++it, ++i);
-        return i;
-    }
 
 template<class T>
 static constexpr bool is_empty_and_trivial = std::is_empty<T>::value && std::is_trivial<T>::value;
@@ -74,7 +59,15 @@ struct first_pair_attribute<T,
                             Meta::void_t<empty_and_trivial_enabler<T>>
                            > : public basic_pair_attribute<T>
 {
-    static T first;  
+    static T first;
+    
+    first_pair_attribute() = default;
+    
+    // The value is not stored, but the construction from a value is still accepted.
+    template<class Arg>
+    constexpr explicit first_pair_attribute(Arg&& arg)
+    : basic_pair_attribute<T>(std::forward<Arg>(arg))
+    {}
 };
 
 template<class T>
@@ -102,6 +95,14 @@ struct last_pair_attribute<T,
                            > : public basic_pair_attribute<T>
 {
     static T last;
+    
+    last_pair_attribute() = default;
+    
+    // The value is not stored, but the construction from a value is still accepted.
+    template<class Arg>
+    constexpr explicit last_pair_attribute(Arg&& arg)
+    : basic_pair_attribute<T>(std::forward<Arg>(arg))
+    {}
 };
 
 template<class T>
@@ -145,58 +146,81 @@ struct reduced_pair
 
 }
 
+/* Sentinel of the ranges over null terminated sequences, like C strings : the end is reached on the first value
+ * equal to a value initialized one. This allows to scan them in a single pass, without computing their size first.
+ */
+struct null_sentinel
+{
+    template<class Iterator>
+    requires std::input_iterator<Iterator>
+    friend constexpr bool operator==(const Iterator& it, null_sentinel) noexcept(noexcept(*it))
+    {
+        return *it == std::iter_value_t<Iterator>{};
+    }
+};
+
 // TODO : Check if is const iterator. If yes, then mark "begin()" and "end()" const.
 
-template<class Iterator>
-struct range : private Details::reduced_pair<Iterator, Iterator>
+/* The end of a range can be of another type than its begining, a sentinel : it only needs to be comparable to the
+ * iterators. Empty sentinels, like null_sentinel, take no space in the range.
+ * The size of a range whose sentinel can not be subtracted from its iterators is computed by walking it, each time it
+ * is asked for.
+ */
+template<class Iterator, class Sentinel = Iterator>
+struct range : private Details::reduced_pair<Iterator, Sentinel>
 {
     using iterator = Iterator;
-    using base = Details::reduced_pair<Iterator, Iterator>;
+    using sentinel = Sentinel;
+    using base = Details::reduced_pair<Iterator, Sentinel>;
     
-    using Details::reduced_pair<Iterator, Iterator>::first;
-    using Details::reduced_pair<Iterator, Iterator>::last;
+    using Details::reduced_pair<Iterator, Sentinel>::first;
+    using Details::reduced_pair<Iterator, Sentinel>::last;
     
     using value_type = typename std::iterator_traits<Iterator>::value_type;
     using difference_type = typename std::iterator_traits<Iterator>::difference_type;
     using reference = typename std::iterator_traits<Iterator>::reference;
     using pointer = typename std::iterator_traits<Iterator>::pointer;
+    
+    static constexpr bool is_sized = std::sized_sentinel_for<Sentinel, Iterator>;
+    static constexpr bool is_common = std::is_same<Iterator, Sentinel>::value;
 
     range() = default;
     
-    template<class OtherIterator,
-             typename = std::enable_if_t<std::is_convertible<OtherIterator, Iterator>::value>>
-    constexpr range(OtherIterator first, OtherIterator last)
+    template<class OtherIterator, class OtherSentinel,
+             typename = std::enable_if_t<std::is_convertible<OtherIterator, Iterator>::value && std::is_convertible<OtherSentinel, Sentinel>::value>>
+    constexpr range(OtherIterator first, OtherSentinel last)
     : base(std::move(first), std::move(last))
     {
-        CONSTEXPR_ASSERT(Details::difference(begin(), end()) >= 0, "The begining of the range is past after the end of the range");
+        // Only checkable without walking the range when its size is known.
+        if constexpr(is_sized)
+        {
+            CONSTEXPR_ASSERT(end() - begin() >= 0, "The begining of the range is past after the end of the range");
+        }
     }
     
-    template<class OtherIterator,
-             typename = std::enable_if_t<std::is_convertible<OtherIterator, Iterator>::value>>
-    constexpr range(range<OtherIterator> rg)
+    template<class OtherIterator, class OtherSentinel,
+             typename = std::enable_if_t<std::is_convertible<OtherIterator, Iterator>::value && std::is_convertible<OtherSentinel, Sentinel>::value>>
+    constexpr range(range<OtherIterator, OtherSentinel> rg)
     : range(rg.first, rg.last)
-    {
-        CONSTEXPR_ASSERT(Details::difference(begin(), end()) >= 0, "The begining of the range is past after the end of the range");
-    }
+    {}
     
     template<class OtherIterator1, class OtherIterator2,
-             typename = std::enable_if_t<std::is_convertible<OtherIterator1, Iterator>::value && std::is_convertible<OtherIterator2, Iterator>::value>>
+             typename = std::enable_if_t<std::is_convertible<OtherIterator1, Iterator>::value && std::is_convertible<OtherIterator2, Sentinel>::value>>
     constexpr range(std::pair<OtherIterator1, OtherIterator2> rg)
     : range(rg.first, rg.second)
-    {
-        CONSTEXPR_ASSERT(Details::difference(begin(), end()) >= 0, "The begining of the range is past after the end of the range");
-    }
+    {}
     
     constexpr reference front() const
     {
-        CONSTEXPR_ASSERT(!empty(), "Attempted to take the first element of an empty range !");
+        CONSTEXPR_BOUNDS_ASSERT(!empty(), "Attempted to take the first element of an empty range !");
         
         return *begin();
     }
     
     constexpr reference back() const
+    requires is_common
     {
-        CONSTEXPR_ASSERT(!empty(), "Attempted to take the last element of an empty range !");
+        CONSTEXPR_BOUNDS_ASSERT(!empty(), "Attempted to take the last element of an empty range !");
         
         Iterator tmp = end();
         --tmp;
@@ -205,24 +229,32 @@ struct range : private Details::reduced_pair<Iterator, Iterator>
     
     constexpr bool empty() const
     {
-        return size() == 0;
+        return first == last;
     }
 
     constexpr size_t size() const
     {
-        return Details::difference(begin(), end());
+        if constexpr(is_sized)
+        {
+            return static_cast<size_t>(end() - begin());
+        }
+        else
+        {
+            return walkedSize();
+        }
     }
     
     constexpr void pop_front()
     {
-        CONSTEXPR_ASSERT(!empty(), "Attempted to pop on an empty range !");    
+        CONSTEXPR_BOUNDS_ASSERT(!empty(), "Attempted to pop on an empty range !");    
     
         ++first;
     }
     
     constexpr void pop_back()
+    requires is_common
     {
-        CONSTEXPR_ASSERT(!empty(), "Attempted to pop on an empty range !");
+        CONSTEXPR_BOUNDS_ASSERT(!empty(), "Attempted to pop on an empty range !");
         
         --last;
     }
@@ -232,10 +264,31 @@ struct range : private Details::reduced_pair<Iterator, Iterator>
         return first;
     }
     
-    constexpr iterator end() const noexcept
+    constexpr sentinel end() const noexcept
     {
         return last;
     }
+    
+private:
+    constexpr size_t walkedSize() const
+    {
+        size_t size = 0;
+        for(auto it = begin(); it != end(); ++it, ++size);
+        return size;
+    }
 };
 
+template<class Iterator, class Sentinel>
+range(Iterator, Sentinel) -> range<Iterator, Sentinel>;
+
+// A range only refers to elements owned elsewhere, so it can be given to std::ranges as a temporary.
+template<class Iterator, class Sentinel>
+inline constexpr bool std::ranges::enable_borrowed_range<range<Iterator, Sentinel>> = true;
+
+// The characters of a C string, up to its null terminator, which is found while iterating.
+constexpr range<const char*, null_sentinel> null_terminated(const char* str) noexcept
+{
+    return {str, null_sentinel{}};
+}
+
 #endif // RANGE_HXX
\ No newline at end of file
@@ -0,0 +1,299 @@
+#ifndef RANGE_CHUNKS_HXX
+#define RANGE_CHUNKS_HXX
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include <ConstexprAssert.hxx>
+#include <Range.hxx>
+#include <RangeViews.hxx>
+
+/* Blocking of contiguous ranges, for the loops processing their elements a SIMD register at a time :
+ *     auto blocks = range<const char*>{data, data + size} | views::chunks<16>();
+ *     for(std::span<const char, 16> block : blocks) { ... }
+ *     for(char c : blocks.remainder()) { ... }
+ * The blocks are fixed size spans, so that the size of the loads is known to the compiler, and the elements left
+ * over, less than a block, are given apart. views::aligned_chunks also gives apart the first elements, up to the
+ * first address aligned on the size of a block, so that the blocks can be loaded with aligned loads. Alignment does
+ * not exist in constant evaluation : the prologue is then always empty, which gives the same blocks as chunks.
+ * views::partitions splits a range in as many parts as threads, each boundary between two parts being on a cache
+ * line, so that no two threads write to the same line.
+ */
+
+namespace Details
+{
+
+inline constexpr size_t cacheLineSize = 64;
+
+template<class Range>
+concept contiguous_sized_range = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+
+// The pointer to the first element, without dereferencing the iterators of an empty range.
+template<class Range>
+constexpr auto contiguous_data(Range& rng)
+{
+	if constexpr(requires { rng.data(); })
+	{
+		return rng.data();
+	}
+	else
+	{
+		return std::to_address(std::ranges::begin(rng));
+	}
+}
+
+// Number of elements before the first one whose address is a multiple of alignment, at most size.
+template<class T>
+constexpr size_t alignment_offset(T* data, size_t size, size_t alignment) noexcept
+{
+	if(std::is_constant_evaluated())
+	{
+		return 0;
+	}
+	const size_t misalignment = reinterpret_cast<uintptr_t>(data) % alignment;
+	const size_t bytes = (alignment - misalignment) % alignment;
+	// Elements not aligned on their own size never reach the alignment.
+	const size_t count = bytes % sizeof(T) == 0 ? bytes / sizeof(T) : size;
+	return count < size ? count : size;
+}
+
+// Like view_closure, but the adaptor gets the elements of a contiguous range as a pointer and a size.
+template<class Fn>
+struct contiguous_closure
+{
+	[[no_unique_address]] Fn fn;
+
+	template<adaptable_range Range>
+	requires contiguous_sized_range<std::remove_reference_t<Range>>
+	constexpr auto operator()(Range&& rng) const
+	{
+		return fn(contiguous_data(rng), static_cast<size_t>(std::ranges::size(rng)));
+	}
+
+	template<adaptable_range Range>
+	requires contiguous_sized_range<std::remove_reference_t<Range>>
+	friend constexpr auto operator|(Range&& rng, const contiguous_closure& closure)
+	{
+		return closure(std::forward<Range>(rng));
+	}
+};
+
+template<class Fn>
+contiguous_closure(Fn) -> contiguous_closure<Fn>;
+
+template<class T, size_t N>
+class chunk_iterator : public view_iterator_base<chunk_iterator<T, N>>
+{
+public:
+	using value_type = std::span<T, N>;
+
+	constexpr chunk_iterator(T* current, T* end) noexcept : current_{current}, end_{end}
+	{}
+
+	constexpr std::span<T, N> operator*() const noexcept { return std::span<T, N>{current_, N}; }
+
+	constexpr chunk_iterator& operator++() noexcept
+	{
+		current_ += N;
+		return *this;
+	}
+
+	constexpr bool atEnd() const noexcept { return current_ == end_; }
+
+private:
+	T* current_;
+	T* end_;
+};
+
+// The blocks of N elements of [first, last), after a prologue of the elements of [first, blocks).
+template<class T, size_t N>
+class chunk_view : public view_base
+{
+public:
+	using iterator = chunk_iterator<T, N>;
+	using sentinel = std::default_sentinel_t;
+	using value_type = std::span<T, N>;
+
+	constexpr chunk_view(T* first, size_t prologueSize, size_t size) noexcept
+	: first_{first}, blocks_{first + prologueSize}, blocksEnd_{blocks_ + (size - prologueSize) / N * N}, last_{first + size}
+	{}
+
+	constexpr iterator begin() const noexcept { return {blocks_, blocksEnd_}; }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+	// Number of blocks.
+	constexpr size_t size() const noexcept { return static_cast<size_t>(blocksEnd_ - blocks_) / N; }
+	constexpr bool empty() const noexcept { return blocks_ == blocksEnd_; }
+
+	constexpr std::span<T> prologue() const noexcept { return {first_, blocks_}; }
+	constexpr std::span<T> remainder() const noexcept { return {blocksEnd_, last_}; }
+
+private:
+	T* first_;
+	T* blocks_;
+	T* blocksEnd_;
+	T* last_;
+};
+
+/* Number of elements before the first one starting a cache line, at most size. Elements whose size does not divide
+ * the size of a line only start one every lcm(sizeof(T), cacheLineSize) bytes, and never if the range is not aligned
+ * on their greatest common divisor : the parts then start at the first element, as no boundary can be on a line.
+ */
+template<class T>
+constexpr size_t cache_line_offset(T* data, size_t size) noexcept
+{
+	if(std::is_constant_evaluated())
+	{
+		return 0;
+	}
+	const size_t misalignment = reinterpret_cast<uintptr_t>(data) % cacheLineSize;
+	const size_t lines = std::lcm(sizeof(T), cacheLineSize) / cacheLineSize;
+	for(size_t bytes = (cacheLineSize - misalignment) % cacheLineSize; bytes < lines * cacheLineSize; bytes += cacheLineSize)
+	{
+		if(bytes % sizeof(T) == 0)
+		{
+			const size_t count = bytes / sizeof(T);
+			return count < size ? count : size;
+		}
+	}
+	return 0;
+}
+
+/* Boundaries of count parts of [data, data + size). The elements before the first cache line are in the first part,
+ * the ones after the last line in the last part, and the lines in between are shared as evenly as possible. A line
+ * here is the smallest run of whole elements spanning whole cache lines, lcm(sizeof(T), cacheLineSize) bytes.
+ */
+template<class T>
+class partition_layout
+{
+public:
+	constexpr partition_layout(T* data, size_t size, size_t count) noexcept
+	: data_{data}, size_{size}, count_{count}, head_{0}, lines_{0}
+	{
+		CONSTEXPR_ASSERT(count != 0, "A range must be split in at least one part");
+		head_ = cache_line_offset(data, size);
+		lines_ = (size - head_) / lineSize;
+	}
+
+	constexpr size_t count() const noexcept { return count_; }
+
+	constexpr std::span<T> part(size_t index) const noexcept
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < count_, "Index out of bounds");
+		return {data_ + boundary(index), data_ + boundary(index + 1)};
+	}
+
+private:
+	static constexpr size_t lineSize = std::lcm(sizeof(T), cacheLineSize) / sizeof(T);
+
+	constexpr size_t boundary(size_t index) const noexcept
+	{
+		if(index == 0)
+		{
+			return 0;
+		}
+		if(index == count_)
+		{
+			return size_;
+		}
+		return head_ + lines_ * index / count_ * lineSize;
+	}
+
+	T* data_;
+	size_t size_;
+	size_t count_;
+	size_t head_;
+	size_t lines_;
+};
+
+template<class T>
+class partition_iterator : public view_iterator_base<partition_iterator<T>>
+{
+public:
+	using value_type = std::span<T>;
+
+	constexpr partition_iterator(partition_layout<T> layout, size_t index) noexcept : layout_{layout}, index_{index}
+	{}
+
+	constexpr std::span<T> operator*() const noexcept { return layout_.part(index_); }
+
+	constexpr partition_iterator& operator++() noexcept
+	{
+		++index_;
+		return *this;
+	}
+
+	constexpr bool atEnd() const noexcept { return index_ == layout_.count(); }
+
+private:
+	partition_layout<T> layout_;
+	size_t index_;
+};
+
+template<class T>
+class partition_view : public view_base
+{
+public:
+	using iterator = partition_iterator<T>;
+	using sentinel = std::default_sentinel_t;
+	using value_type = std::span<T>;
+
+	constexpr explicit partition_view(partition_layout<T> layout) noexcept : layout_{layout}
+	{}
+
+	constexpr iterator begin() const noexcept { return {layout_, 0}; }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+	constexpr size_t size() const noexcept { return layout_.count(); }
+	constexpr std::span<T> operator[](size_t index) const noexcept { return layout_.part(index); }
+
+private:
+	partition_layout<T> layout_;
+};
+
+}
+
+namespace views
+{
+
+// The consecutive blocks of N elements of a contiguous range, the elements left over being its remainder().
+template<size_t N>
+constexpr auto chunks()
+{
+	static_assert(N != 0, "Blocks must have at least one element");
+	return Details::contiguous_closure{[]<class T>(T* data, size_t size) {
+		return Details::chunk_view<T, N>{data, 0, size};
+	}};
+}
+
+/* The blocks of N elements of a contiguous range whose addresses are multiples of the size of a block, the elements
+ * before the first one being its prologue(), and the ones after the last one its remainder().
+ */
+template<size_t N>
+constexpr auto aligned_chunks()
+{
+	static_assert(N != 0, "Blocks must have at least one element");
+	return Details::contiguous_closure{[]<class T>(T* data, size_t size) {
+		static_assert(std::has_single_bit(N * sizeof(T)), "The size of a block must be a power of two to be aligned on");
+		return Details::chunk_view<T, N>{data, Details::alignment_offset(data, size, N * sizeof(T)), size};
+	}};
+}
+
+// The count parts of a contiguous range to give to count threads, split on cache lines. part[i] is for the thread i.
+constexpr auto partitions(size_t count)
+{
+	return Details::contiguous_closure{[count]<class T>(T* data, size_t size) {
+		return Details::partition_view<T>{Details::partition_layout<T>{data, size, count}};
+	}};
+}
+
+}
+
+#endif // RANGE_CHUNKS_HXX
@@ -0,0 +1,357 @@
+#ifndef RANGE_VIEWS_HXX
+#define RANGE_VIEWS_HXX
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <ConstexprAssert.hxx>
+#include <Range.hxx>
+
+/* Lazy adaptors over ranges, like range, EnumName::iter(), or any container given as an lvalue :
+ *     for(auto level : LogLevel::iter() | views::filter(isError) | views::transform(toSeverity))
+ * An adaptor builds a view holding the iterators of the range it adapts, and its own function object : nothing is
+ * stored nor computed before iterating, and a chain of adaptors is a single loop over the adapted range.
+ * The views can be evaluated in constant expressions, so that tables derived from an enum can be computed at
+ * compile time with views::to_array :
+ *     constexpr auto errors = [] { return LogLevel::iter() | views::filter(isError); };
+ *     constexpr auto errorTable = views::to_array<views::count(errors())>(errors());
+ * The iterators of a view all know where their end is, so the end of every view is std::default_sentinel.
+ * They are only meant to be iterated over once, from begin to end : they are input iterators.
+ */
+
+namespace Details
+{
+
+// Base of the views, marking them as ranges that can be adapted as temporaries.
+struct view_base
+{};
+
+template<class Range>
+using iterator_t = decltype(std::declval<Range&>().begin());
+
+template<class Range>
+using sentinel_t = decltype(std::declval<Range&>().end());
+
+// A temporary given to an adaptor must not own the elements the view would refer to.
+template<class Range>
+concept adaptable_range = std::is_lvalue_reference<Range>::value
+					   || std::derived_from<std::remove_cvref_t<Range>, view_base>
+					   || std::ranges::enable_borrowed_range<std::remove_cvref_t<Range>>;
+
+// The result of an adaptor given its arguments but the range : applied to a range with operator|.
+template<class Fn>
+struct view_closure
+{
+	[[no_unique_address]] Fn fn;
+
+	template<adaptable_range Range>
+	constexpr auto operator()(Range&& rng) const
+	{
+		return fn(rng.begin(), rng.end());
+	}
+
+	template<adaptable_range Range>
+	friend constexpr auto operator|(Range&& rng, const view_closure& closure)
+	{
+		return closure(std::forward<Range>(rng));
+	}
+};
+
+template<class Fn>
+view_closure(Fn) -> view_closure<Fn>;
+
+// The iterators share their interface, only the way they move and what they give differ.
+template<class Derived>
+struct view_iterator_base
+{
+	using iterator_concept = std::input_iterator_tag;
+	using difference_type = ptrdiff_t;
+
+	constexpr Derived operator++(int)
+	{
+		Derived tmp{static_cast<const Derived&>(*this)};
+		++static_cast<Derived&>(*this);
+		return tmp;
+	}
+
+	friend constexpr bool operator==(const Derived& it, std::default_sentinel_t)
+	{
+		return it.atEnd();
+	}
+};
+
+template<class Iterator, class Sentinel, class Predicate>
+class filter_iterator : public view_iterator_base<filter_iterator<Iterator, Sentinel, Predicate>>
+{
+public:
+	using value_type = std::iter_value_t<Iterator>;
+
+	constexpr filter_iterator(Iterator current, Sentinel end, Predicate predicate)
+	: current_{std::move(current)}, end_{std::move(end)}, predicate_{std::move(predicate)}
+	{
+		skip();
+	}
+
+	constexpr decltype(auto) operator*() const { return *current_; }
+
+	constexpr filter_iterator& operator++()
+	{
+		++current_;
+		skip();
+		return *this;
+	}
+
+	constexpr bool atEnd() const { return current_ == end_; }
+
+private:
+	constexpr void skip()
+	{
+		while(current_ != end_ && !predicate_(*current_))
+		{
+			++current_;
+		}
+	}
+
+	Iterator current_;
+	[[no_unique_address]] Sentinel end_;
+	[[no_unique_address]] Predicate predicate_;
+};
+
+template<class Iterator, class Sentinel, class Function>
+class transform_iterator : public view_iterator_base<transform_iterator<Iterator, Sentinel, Function>>
+{
+public:
+	using value_type = std::remove_cvref_t<std::invoke_result_t<const Function&, std::iter_reference_t<Iterator>>>;
+
+	constexpr transform_iterator(Iterator current, Sentinel end, Function function)
+	: current_{std::move(current)}, end_{std::move(end)}, function_{std::move(function)}
+	{}
+
+	constexpr decltype(auto) operator*() const { return function_(*current_); }
+
+	constexpr transform_iterator& operator++()
+	{
+		++current_;
+		return *this;
+	}
+
+	constexpr bool atEnd() const { return current_ == end_; }
+
+private:
+	Iterator current_;
+	[[no_unique_address]] Sentinel end_;
+	[[no_unique_address]] Function function_;
+};
+
+template<class Iterator, class Sentinel>
+class take_iterator : public view_iterator_base<take_iterator<Iterator, Sentinel>>
+{
+public:
+	using value_type = std::iter_value_t<Iterator>;
+
+	constexpr take_iterator(Iterator current, Sentinel end, size_t count)
+	: current_{std::move(current)}, end_{std::move(end)}, remaining_{count}
+	{}
+
+	constexpr decltype(auto) operator*() const { return *current_; }
+
+	constexpr take_iterator& operator++()
+	{
+		++current_;
+		--remaining_;
+		return *this;
+	}
+
+	constexpr bool atEnd() const { return remaining_ == 0 || current_ == end_; }
+
+private:
+	Iterator current_;
+	[[no_unique_address]] Sentinel end_;
+	size_t remaining_;
+};
+
+template<class Iterator, class Sentinel>
+class enumerate_iterator : public view_iterator_base<enumerate_iterator<Iterator, Sentinel>>
+{
+public:
+	using value_type = std::pair<size_t, std::iter_value_t<Iterator>>;
+
+	constexpr enumerate_iterator(Iterator current, Sentinel end)
+	: current_{std::move(current)}, end_{std::move(end)}, index_{0}
+	{}
+
+	constexpr std::pair<size_t, std::iter_reference_t<Iterator>> operator*() const { return {index_, *current_}; }
+
+	constexpr enumerate_iterator& operator++()
+	{
+		++current_;
+		++index_;
+		return *this;
+	}
+
+	constexpr bool atEnd() const { return current_ == end_; }
+
+private:
+	Iterator current_;
+	[[no_unique_address]] Sentinel end_;
+	size_t index_;
+};
+
+template<class Iterator1, class Sentinel1, class Iterator2, class Sentinel2>
+class zip_iterator : public view_iterator_base<zip_iterator<Iterator1, Sentinel1, Iterator2, Sentinel2>>
+{
+public:
+	using value_type = std::pair<std::iter_value_t<Iterator1>, std::iter_value_t<Iterator2>>;
+
+	constexpr zip_iterator(Iterator1 current1, Sentinel1 end1, Iterator2 current2, Sentinel2 end2)
+	: current1_{std::move(current1)}, end1_{std::move(end1)}, current2_{std::move(current2)}, end2_{std::move(end2)}
+	{}
+
+	constexpr std::pair<std::iter_reference_t<Iterator1>, std::iter_reference_t<Iterator2>> operator*() const
+	{
+		return {*current1_, *current2_};
+	}
+
+	constexpr zip_iterator& operator++()
+	{
+		++current1_;
+		++current2_;
+		return *this;
+	}
+
+	// The shortest of the two ranges gives the end.
+	constexpr bool atEnd() const { return current1_ == end1_ || current2_ == end2_; }
+
+private:
+	Iterator1 current1_;
+	[[no_unique_address]] Sentinel1 end1_;
+	Iterator2 current2_;
+	[[no_unique_address]] Sentinel2 end2_;
+};
+
+// Every view is its first iterator, which knows where to stop.
+template<class Iterator>
+class view : public view_base
+{
+public:
+	using iterator = Iterator;
+	using sentinel = std::default_sentinel_t;
+	using value_type = typename Iterator::value_type;
+
+	constexpr explicit view(Iterator first) : first_{std::move(first)}
+	{}
+
+	constexpr Iterator begin() const { return first_; }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+private:
+	Iterator first_;
+};
+
+template<class Iterator>
+view(Iterator) -> view<Iterator>;
+
+}
+
+// The views do not own the elements they give, so they can be adapted, or given to std::ranges, as temporaries.
+template<class T>
+requires std::derived_from<T, Details::view_base>
+inline constexpr bool std::ranges::enable_borrowed_range<T> = true;
+
+namespace views
+{
+
+// The elements for which predicate is true.
+template<class Predicate>
+constexpr auto filter(Predicate predicate)
+{
+	return Details::view_closure{[predicate]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		return Details::view{Details::filter_iterator<Iterator, Sentinel, Predicate>{std::move(first), std::move(last), predicate}};
+	}};
+}
+
+// The results of function applied to the elements, computed when they are dereferenced.
+template<class Function>
+constexpr auto transform(Function function)
+{
+	return Details::view_closure{[function]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		return Details::view{Details::transform_iterator<Iterator, Sentinel, Function>{std::move(first), std::move(last), function}};
+	}};
+}
+
+// The count first elements, or all of them if there are less.
+constexpr auto take(size_t count)
+{
+	return Details::view_closure{[count]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		return Details::view{Details::take_iterator<Iterator, Sentinel>{std::move(first), std::move(last), count}};
+	}};
+}
+
+// All the elements but the count first ones. As the rest is not adapted, this is a plain range.
+constexpr auto drop(size_t count)
+{
+	return Details::view_closure{[count]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		for(size_t i = 0; i < count && first != last; ++i)
+		{
+			++first;
+		}
+		return range<Iterator, Sentinel>{std::move(first), std::move(last)};
+	}};
+}
+
+// Pairs of the index of each element, from 0, and of the element.
+constexpr auto enumerate()
+{
+	return Details::view_closure{[]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		return Details::view{Details::enumerate_iterator<Iterator, Sentinel>{std::move(first), std::move(last)}};
+	}};
+}
+
+/* Pairs of the elements of both ranges, in order, up to the end of the shortest one. Zipping an enum range with an
+ * array of the same size gives a constant time map from the enumerators to the elements of the array.
+ */
+template<Details::adaptable_range Other>
+constexpr auto zip(Other&& other)
+{
+	using Iterator2 = Details::iterator_t<Other>;
+	using Sentinel2 = Details::sentinel_t<Other>;
+	return Details::view_closure{[first2 = other.begin(), last2 = other.end()]<class Iterator, class Sentinel>(Iterator first, Sentinel last) {
+		return Details::view{Details::zip_iterator<Iterator, Sentinel, Iterator2, Sentinel2>{std::move(first), std::move(last), first2, last2}};
+	}};
+}
+
+// Number of elements of a range, walking it if needed.
+template<class Range>
+constexpr size_t count(Range&& rng)
+{
+	size_t size = 0;
+	for(auto it = rng.begin(); it != rng.end(); ++it)
+	{
+		++size;
+	}
+	return size;
+}
+
+// The elements of a range with exactly size elements, as an array. Usable in constant expressions.
+template<size_t size, class Range>
+constexpr auto to_array(Range&& rng)
+{
+	using value_type = std::iter_value_t<Details::iterator_t<Range>>;
+	std::array<value_type, size> result{};
+	size_t index = 0;
+	for(auto it = rng.begin(); it != rng.end(); ++it, ++index)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < size, "The range has more elements than the array");
+		result[index] = *it;
+	}
+	CONSTEXPR_BOUNDS_ASSERT(index == size, "The range has less elements than the array");
+	return result;
+}
+
+}
+
+#endif // RANGE_VIEWS_HXX
@@ -0,0 +1,172 @@
+#ifndef STATIC_RING_HXX
+#define STATIC_RING_HXX
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <ArrayIteratorPolicy.hxx>
+#include <ConstexprAssert.hxx>
+#include <MetaUtils.hxx>
+
+// What to do when pushing to a full StaticRing.
+enum class RingOverflowPolicy : uint8_t
+{
+	Assert,		// The push is an error
+	Overwrite	// The element at the other end is dropped to make room
+};
+
+/* Double ended queue of at most Tcapacity elements, stored inline in a circular buffer : the last events or states
+ * seen by a component can be kept without any allocation. As for StaticVector, all the elements are always
+ * constructed, so T must be default constructible, and a StaticRing is usable in constant expressions and is
+ * trivially copyable when T is.
+ * The elements are not contiguous in memory, so the iterators are the index based ones of ArrayIteratorPolicy,
+ * going through operator[], whatever ARRAY_ITERATOR_CHECKED.
+ */
+template<class T, size_t Tcapacity>
+class StaticRing
+{
+	static_assert(Tcapacity != 0, "A StaticRing must be able to hold at least one element");
+
+	using IterPolicy = ArrayIteratorPolicy<StaticRing<T, Tcapacity>>;
+	using SizeType = Meta::smallest_unsigned_t<Tcapacity>;
+
+public:
+	using value_type = T;
+	using reference = T&;
+	using const_reference = const T&;
+	using size_type = size_t;
+
+	using iterator = typename IterPolicy::indexed_iterator;
+	using reverse_iterator = typename IterPolicy::indexed_reverse_iterator;
+	using const_iterator = typename IterPolicy::indexed_const_iterator;
+	using const_reverse_iterator = typename IterPolicy::indexed_const_reverse_iterator;
+
+public:
+	constexpr StaticRing() noexcept(std::is_nothrow_default_constructible<T>::value) : elements_{}, head_{0}, size_{0}
+	{}
+
+	constexpr iterator begin() noexcept { return{ *this, 0 }; }
+	constexpr const_iterator begin() const noexcept { return{ *this, 0 }; }
+	constexpr const_iterator cbegin() const noexcept { return begin(); }
+	constexpr iterator end() noexcept { return{ *this, size() }; }
+	constexpr const_iterator end() const noexcept { return{ *this, size() }; }
+	constexpr const_iterator cend() const noexcept { return end(); }
+
+	constexpr reverse_iterator rbegin() noexcept { return end(); }
+	constexpr const_reverse_iterator rbegin() const noexcept { return cend(); }
+	constexpr const_reverse_iterator crbegin() const noexcept { return cend(); }
+	constexpr reverse_iterator rend() noexcept { return begin(); }
+	constexpr const_reverse_iterator rend() const noexcept { return cbegin(); }
+	constexpr const_reverse_iterator crend() const noexcept { return cbegin(); }
+
+	// Index from the front of the ring.
+	constexpr T& at(size_t index)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticRing");
+		return elements_[slot(index)];
+	}
+
+	constexpr const T& at(size_t index) const
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticRing");
+		return elements_[slot(index)];
+	}
+
+	constexpr T& operator[](size_t index) { return at(index); }
+	constexpr const T& operator[](size_t index) const { return at(index); }
+
+	constexpr T& front() { return at(0); }
+	constexpr const T& front() const { return at(0); }
+	constexpr T& back() { return at(size() - 1); }
+	constexpr const T& back() const { return at(size() - 1); }
+
+	constexpr size_t size() const noexcept { return size_; }
+	static constexpr size_t capacity() noexcept { return Tcapacity; }
+	constexpr bool empty() const noexcept { return size_ == 0; }
+	constexpr bool full() const noexcept { return size_ == Tcapacity; }
+
+	template<RingOverflowPolicy policy = RingOverflowPolicy::Assert>
+	constexpr void push_back(T value)
+	{
+		if(full())
+		{
+			if constexpr(policy == RingOverflowPolicy::Assert)
+			{
+				CONSTEXPR_FAIL("Pushing to a full StaticRing");
+			}
+			pop_front();
+		}
+		elements_[slot(size_)] = std::move(value);
+		++size_;
+	}
+
+	template<RingOverflowPolicy policy = RingOverflowPolicy::Assert>
+	constexpr void push_front(T value)
+	{
+		if(full())
+		{
+			if constexpr(policy == RingOverflowPolicy::Assert)
+			{
+				CONSTEXPR_FAIL("Pushing to a full StaticRing");
+			}
+			pop_back();
+		}
+		head_ = static_cast<SizeType>(head_ == 0 ? Tcapacity - 1 : head_ - 1);
+		elements_[head_] = std::move(value);
+		++size_;
+	}
+
+	constexpr void pop_front()
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!empty(), "Popping an empty StaticRing");
+		release(head_);
+		head_ = static_cast<SizeType>(slot(1));
+		--size_;
+	}
+
+	constexpr void pop_back()
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!empty(), "Popping an empty StaticRing");
+		--size_;
+		release(slot(size_));
+	}
+
+	constexpr void clear() noexcept(std::is_trivially_destructible<T>::value)
+	{
+		while(!empty())
+		{
+			pop_back();
+		}
+		head_ = 0;
+	}
+
+private:
+	// Position in the buffer of the element at index from the front, without a division.
+	constexpr size_t slot(size_t index) const noexcept
+	{
+		const size_t position = head_ + index;
+		return position < Tcapacity ? position : position - Tcapacity;
+	}
+
+	// The elements out of the ring own nothing : the ones owning resources are reset.
+	constexpr void release(size_t position)
+	{
+		if constexpr(!std::is_trivially_destructible<T>::value)
+		{
+			elements_[position] = T{};
+		}
+		else
+		{
+			static_cast<void>(position);
+		}
+	}
+
+	std::array<T, Tcapacity> elements_;
+	SizeType head_;
+	SizeType size_;
+};
+
+#endif // STATIC_RING_HXX
@@ -1,18 +1,90 @@
 #ifndef STATIC_STRING_HXX
 #define STATIC_STRING_HXX
 
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
 #include <ArrayIteratorPolicy.hxx>
 #include <ConstexprAssert.hxx>
 #include <ConstString.hxx>
+#include <MetaUtils.hxx>
 #include <Range.hxx>
 #include <StringDetails.hxx>
 
+/* By default, StaticString of less than 256 characters keep their size in the last byte of the character array,
+ * as the remaining capacity : it is 0 when the string is full, and then doubles as the null terminator.
+ * Such a StaticString<N> is thus exactly N + 1 bytes, and arrays of them are densely packed.
+ * Define STATIC_STRING_COMPACT_LAYOUT to 0 to store the size in a separate member instead, still of the
+ * smallest unsigned type able to hold the capacity.
+ */
+#ifndef STATIC_STRING_COMPACT_LAYOUT
+#define STATIC_STRING_COMPACT_LAYOUT 1
+#endif
+
+namespace Details
+{
+
+template<size_t Tsize>
+using StaticStringSizeType = Meta::smallest_unsigned_t<Tsize>;
+
+template<size_t Tsize, bool compact = STATIC_STRING_COMPACT_LAYOUT && (Tsize <= UINT8_MAX)>
+struct StaticStringStorage
+{
+	constexpr size_t getSize() const noexcept
+	{
+		return size;
+	}
+
+	constexpr void setSize(size_t newSize) noexcept
+	{
+		chars[newSize] = '\0';
+		size = static_cast<StaticStringSizeType<Tsize>>(newSize);
+	}
+
+	std::array<char, Tsize + 1> chars;
+	StaticStringSizeType<Tsize> size;
+};
+
+template<size_t Tsize>
+struct StaticStringStorage<Tsize, true>
+{
+	constexpr size_t getSize() const noexcept
+	{
+		return Tsize - static_cast<unsigned char>(chars[Tsize]);
+	}
+
+	constexpr void setSize(size_t newSize) noexcept
+	{
+		chars[newSize] = '\0';
+		chars[Tsize] = static_cast<char>(Tsize - newSize);
+	}
+
+	std::array<char, Tsize + 1> chars;
+};
+
+}
+
+// What to do when appending to a StaticString past its capacity.
+enum class TruncationPolicy : uint8_t
+{
+	Assert,		// The append is an error
+	Truncate	// What fits is kept, the rest is silently dropped
+};
+
 template<size_t Tsize>
 class StaticString
 {
 	using IterPolicy = ArrayIteratorPolicy<StaticString<Tsize>>;
 	
 public:
+	using value_type = char;
+	using reference = char&;
+	using pointer = char*;
+	
 	using iterator = typename IterPolicy::iterator;
 	using reverse_iterator = typename IterPolicy::reverse_iterator;
 	using const_iterator = typename IterPolicy::const_iterator;
@@ -22,39 +94,47 @@ public:
 	using unchecked_reverse_iterator = typename IterPolicy::unchecked_reverse_iterator;
 	using unchecked_const_reverse_iterator = typename IterPolicy::unchecked_const_reverse_iterator;
 	
-	using value_type = char;
-	using reference = char&;
-	using pointer = char*;
-	
 public:
 	// Serve for the sole purpose of begin able to be literal type even with default constructor
-	constexpr StaticString() : str_{}, actualSize_{}
-	{}
-	constexpr StaticString(const StaticString& other) : str_{other.str_}, actualSize_{other.actualSize_}
+	constexpr StaticString() : storage_{}
+	{
+		storage_.setSize(0);
+	}
+	constexpr StaticString(const StaticString& other) : storage_{other.storage_}
 	{
 		//static_assert(otherSize <= Tsize, "The string used to initialize the StaticString do not fit !");
 	}
 	
+	constexpr StaticString& operator=(const StaticString& other) = default;
+	
 	template<size_t otherSize>
-	constexpr StaticString(const StaticString<otherSize>& other) : str_{other.str_}, actualSize_{other.actualSize_}
+	constexpr StaticString(const StaticString<otherSize>& other) : StaticString{}
 	{
 		static_assert(otherSize <= Tsize, "The string used to initialize the StaticString do not fit !");
+		append(other);
 	}
 	
 	template<size_t otherSize>
-	constexpr StaticString(const char(&cstr)[otherSize]) : str_{initStr<otherSize - 1>(ConstString{cstr})}, actualSize_{otherSize - 1}
+	constexpr StaticString(const char(&cstr)[otherSize]) : storage_{}
 	{
 		static_assert(otherSize <= (Tsize + 1), "The string used to initialize the StaticString do not fit !");
+		Details::copyBytes(storage_.chars.data(), cstr, otherSize - 1);
+		storage_.setSize(otherSize - 1);
 	}
 
 	template<class Iterator>
 	constexpr StaticString(Iterator begin, Iterator end) : StaticString{range<Iterator>{begin, end}}
 	{}
 	
-	template<class Iterator>
-	constexpr StaticString(range<Iterator> range) : str_{initStrRange<Iterator, Tsize>(range)}, actualSize_{range.size()}
+	// Ranges whose size is not known in constant time, like the null terminated ones, are copied in a single pass.
+	template<class Iterator, class Sentinel>
+	constexpr StaticString(range<Iterator, Sentinel> range) : storage_{}
 	{
-		CONSTEXPR_ASSERT(range.size() <= Tsize, "Range do not fit in the StaticString !");
+		if constexpr(std::sized_sentinel_for<Sentinel, Iterator>)
+		{
+			CONSTEXPR_BOUNDS_ASSERT(range.size() <= Tsize, "Range do not fit in the StaticString !");
+		}
+		storage_.setSize(copyRange(range));
 	}
 	
 	// Slow version to compile on libc++ which seems buggy on my archlinux.
@@ -64,31 +144,31 @@ public:
 		//CONSTEXPR_ASSERT(str.size() <= Tsize, "The string used to initialize the StaticString do not fit !");
 	}*/
 	
-	constexpr iterator begin() noexcept { return{ *this, 0 }; }
-	constexpr const_iterator begin() const noexcept { return{ *this, 0 }; }
+	constexpr iterator begin() noexcept { return IterPolicy::makeIterator(*this, 0); }
+	constexpr const_iterator begin() const noexcept { return IterPolicy::makeIterator(*this, 0); }
 	constexpr const_iterator cbegin() const noexcept { return begin(); }
-	constexpr iterator end() noexcept { return{ *this, size() }; }
-	constexpr const_iterator end() const noexcept { return{ *this, size() }; }
+	constexpr iterator end() noexcept { return IterPolicy::makeIterator(*this, size()); }
+	constexpr const_iterator end() const noexcept { return IterPolicy::makeIterator(*this, size()); }
 	constexpr const_iterator cend() const noexcept { return end(); }
 
-	constexpr reverse_iterator rbegin() noexcept { return end(); }
-	constexpr const_reverse_iterator rbegin() const noexcept { return cend(); }
-	constexpr const_reverse_iterator crbegin() const noexcept { return cend(); }
-	constexpr reverse_iterator rend() noexcept { return begin(); }
-	constexpr const_reverse_iterator rend() const noexcept { return cbegin(); }
-	constexpr const_reverse_iterator crend() const noexcept { return cbegin(); }
+	constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{ end() }; }
+	constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ cend() }; }
+	constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator{ cend() }; }
+	constexpr reverse_iterator rend() noexcept { return reverse_iterator{ begin() }; }
+	constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ cbegin() }; }
+	constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator{ cbegin() }; }
 
 	constexpr char& at(size_t index)
 	{
-		CONSTEXPR_ASSERT(index < actualSize_, "Attempt to access a non-existing index of a StaticString");
-		return str_[index];
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticString");
+		return storage_.chars[index];
 		//return (index < actualSize_ ? str_[index] : throw std::out_of_range("Attempt to access a non-existing index of a StaticString"));
 	}
 	
 	constexpr const char& at(size_t index) const
 	{
-		CONSTEXPR_ASSERT(index < actualSize_, "Attempt to access a non-existing index of a StaticString");
-		return str_[index];
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticString");
+		return storage_.chars[index];
 	}
 	
 	constexpr char& operator[](size_t index)
@@ -105,67 +185,126 @@ public:
 
 	constexpr const char* data() const
 	{
-		return &str_[0];
+		return storage_.chars.data();
 	}
 	
 	constexpr char* data()
 	{
-		return &str_[0];
+		return storage_.chars.data();
 	}
 	
 	constexpr void resize(size_t newSize) noexcept
 	{
-		CONSTEXPR_ASSERT(newSize <= Tsize, "Cannot resize a StaticString past it's maximum size");
+		CONSTEXPR_BOUNDS_ASSERT(newSize <= Tsize, "Cannot resize a StaticString past it's maximum size");
 		
-		actualSize_ = newSize;
+		storage_.setSize(newSize);
 	}
 	
-	constexpr auto find(char c) noexcept
+	static constexpr size_t capacity() noexcept { return Tsize; }
+	
+	constexpr bool empty() const noexcept { return size() == 0; }
+	
+	constexpr void clear() noexcept
 	{
-		for(auto it = begin(); it != end(); ++it)
+		storage_.setSize(0);
+	}
+	
+	/* Bounded string building. Every append keeps the string null terminated, and returns *this so calls can be
+	 * chained. Nothing is allocated, so a log line can be built on the stack :
+	 *     StaticString<128> line;
+	 *     line.append("Connection ").append(id).append(" closed after ").append(seconds, 2).append('s');
+	 */
+	template<TruncationPolicy policy = TruncationPolicy::Assert>
+	constexpr StaticString& append(ConstString str) noexcept
+	{
+		const size_t currentSize = size();
+		size_t count = str.size();
+		if(count > Tsize - currentSize)
 		{
-			if(*it == c)
+			if constexpr(policy == TruncationPolicy::Assert)
 			{
-				return it; 
+				CONSTEXPR_FAIL("Appending past the capacity of a StaticString");
 			}
+			count = Tsize - currentSize;
 		}
-		return end();	
+		
+		Details::copyBytes(storage_.chars.data() + currentSize, str.data(), count);
+		storage_.setSize(currentSize + count);
+		return *this;
 	}
 	
-	constexpr auto find(char c) const noexcept
+	template<TruncationPolicy policy = TruncationPolicy::Assert>
+	constexpr StaticString& append(char c) noexcept
 	{
-		for(auto it = cbegin(); it != cend(); ++it)
+		const size_t currentSize = size();
+		if(currentSize == Tsize)
 		{
-			if(*it == c)
+			if constexpr(policy == TruncationPolicy::Assert)
 			{
-				return it; 
+				CONSTEXPR_FAIL("Appending past the capacity of a StaticString");
 			}
+			return *this;
 		}
-		return cend();
+		
+		storage_.chars[currentSize] = c;
+		storage_.setSize(currentSize + 1);
+		return *this;
 	}
 	
-	constexpr auto findLastOf(char c) noexcept
+	template<TruncationPolicy policy = TruncationPolicy::Assert, class Integer,
+	         std::enable_if_t<Details::is_formattable_integer<Integer>, bool> = true>
+	constexpr StaticString& append(Integer value) noexcept
 	{
-		for(auto it = rbegin(); it != rend(); ++it)
+		char buffer[Details::maxIntegerDigits] = {};
+		return append<policy>(ConstString{buffer, Details::formatInteger(buffer, value)});
+	}
+	
+	/* Shortest representation giving back the same value, or fixed notation with the given number of decimals.
+	 * Not constexpr, as std::to_chars is not for floating point values.
+	 */
+	template<TruncationPolicy policy = TruncationPolicy::Assert, class Float,
+	         std::enable_if_t<std::is_floating_point<Float>::value, bool> = true>
+	StaticString& append(Float value, int precision = -1) noexcept
+	{
+		constexpr int maxPrecision = 32;
+		char buffer[64];
+		
+		std::to_chars_result result = precision < 0
+		                            ? std::to_chars(buffer, buffer + sizeof(buffer), value)
+		                            : std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, std::min(precision, maxPrecision));
+		if(result.ec != std::errc{})
 		{
-			if(*it == c)
-			{
-				return it;
-			}
+			// Too many digits in fixed notation, for very large values.
+			result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::scientific, std::min(precision, maxPrecision));
 		}
-		return rend();
+		return append<policy>(ConstString{buffer, static_cast<size_t>(result.ptr - buffer)});
+	}
+	
+	constexpr void push_back(char c) noexcept
+	{
+		append(c);
+	}
+	
+	constexpr auto find(char c) noexcept
+	{
+		return begin() + Details::findByte(data(), size(), c);
+	}
+	
+	constexpr auto find(char c) const noexcept
+	{
+		return cbegin() + Details::findByte(data(), size(), c);
+	}
+	
+	constexpr auto findLastOf(char c) noexcept
+	{
+		const size_t index = Details::findLastByte(data(), size(), c);
+		return index != size() ? rbegin() + (size() - 1 - index) : rend();
 	}
 	
 	constexpr auto findLastOf(char c) const noexcept
 	{
-		for(auto it = crbegin(); it != crend(); ++it)
-		{
-			if(*it == c)
-			{
-				return it;
-			}
-		}
-		return crend();
+		const size_t index = Details::findLastByte(data(), size(), c);
+		return index != size() ? crbegin() + (size() - 1 - index) : crend();
 	}
 	
 	constexpr StaticString trim() const noexcept
@@ -179,8 +318,7 @@ public:
 		{
 			if(*it == ' ')
 			{
-				*it = '\0';
-				--actualSize_;
+				storage_.setSize(size() - 1);
 			}
 			else
 			{ 
@@ -228,7 +366,7 @@ public:
     	return false;
     }*/
 
-	constexpr size_t size() const noexcept { return actualSize_; }
+	constexpr size_t size() const noexcept { return storage_.getSize(); }
 
 private:
 	/* 
@@ -250,39 +388,39 @@ private:
 		const range<Iterator>& range_;	
 	}; */
 
-	template<size_t size>
-	constexpr std::array<char, Tsize + 1> initStr(ConstString cstr) const noexcept
-	{
-		return initStrAux(cstr, std::make_integer_sequence<size_t, size>{});
-	}
-	
-	template<class Iterator, size_t size>
-	constexpr std::array<char, Tsize + 1> initStrRange(const range<Iterator>& range) const noexcept
-	{
-		//using IteratorType = std::conditional_t<Meta::is_iterator_of<StaticString, Iterator>::value, unchecked_const_iterator, Iterator>;
-		return initStrRangeAux(range, std::make_integer_sequence<size_t, size>{});
-	}
-	
-	template<size_t ... indices>
-	constexpr std::array<char, Tsize + 1> initStrAux(ConstString cstr, std::integer_sequence<size_t, indices...>) const noexcept
+	// A plain loop rather than an index sequence expansion : the cost of constant evaluation stays linear in the
+	// size of the string, instead of instantiating and expanding one element per character of the capacity.
+	// Contiguous ranges are copied at once, which is a memcpy at runtime.
+	template<class Iterator, class Sentinel>
+	constexpr size_t copyRange(const range<Iterator, Sentinel>& range) noexcept
 	{
-		return {{cstr[indices]...}};
-	}
-	
-	template<class Iterator, size_t ... indices>
-	constexpr std::array<char, Tsize + 1> initStrRangeAux(const range<Iterator>& range, std::integer_sequence<size_t, indices...>) const noexcept
-	{
-		return {{((range.begin() + indices) < range.end() ? *(range.begin() + indices) : '\0')...}};
+		auto it = range.begin();
+		const auto end = range.end();
+		if constexpr(std::contiguous_iterator<Iterator> && std::sized_sentinel_for<Sentinel, Iterator>)
+		{
+			const size_t size = end - it;
+			Details::copyBytes(storage_.chars.data(), std::to_address(it), size);
+			return size;
+		}
+		else
+		{
+			size_t size = 0;
+			for(; it != end && size < Tsize; ++it, ++size)
+			{
+				storage_.chars[size] = *it;
+			}
+			CONSTEXPR_BOUNDS_ASSERT(it == end, "Range do not fit in the StaticString !");
+			return size;
+		}
 	}
 
-	std::array<char, Tsize + 1> str_;
-	size_t actualSize_;
+	Details::StaticStringStorage<Tsize> storage_;
 };
 
 template<size_t TSize1, size_t TSize2>
 constexpr bool operator==(StaticString<TSize1>& lhs, StaticString<TSize2> rhs)
 {
-	return lhs.size() != rhs.size() ? false : Details::equalAux(lhs.size(), lhs, rhs);
+	return lhs.size() != rhs.size() ? false : Details::equalBytes(lhs.data(), rhs.data(), lhs.size());
 }
 
 template<size_t TSize1, size_t TSize2>
@@ -295,7 +433,7 @@ template<size_t TSize1, size_t TSize2>
 constexpr bool operator==(const StaticString<TSize1>& lhs, const char (&rhs)[TSize2])
 {
 	ConstString tmp{rhs};
-	return lhs.size() != tmp.size() ? false : Details::equalAux(lhs.size(), lhs, tmp);
+	return lhs.size() != tmp.size() ? false : Details::equalBytes(lhs.data(), tmp.data(), lhs.size());
 }
 	
 template<size_t TSize1, size_t TSize2>
@@ -319,7 +457,7 @@ constexpr bool operator!=(const StaticString<TSize1>& lhs, const char (&rhs)[TSi
 template<size_t TSize>
 constexpr bool operator==(const StaticString<TSize>& rhs, ConstString lhs)
 {
-	return lhs.size() != rhs.size() ? false : Details::equalAux(lhs.size(), lhs, rhs);
+	return lhs.size() != rhs.size() ? false : Details::equalBytes(lhs.data(), rhs.data(), lhs.size());
 }
 	
 template<size_t TSize>
@@ -340,4 +478,68 @@ constexpr bool operator!=(ConstString lhs, const StaticString<TSize>& rhs)
 	return !(rhs == lhs);
 }
 
+template<size_t TSize1, size_t TSize2>
+constexpr std::strong_ordering operator<=>(const StaticString<TSize1>& lhs, const StaticString<TSize2>& rhs)
+{
+	return Details::compareBytes(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+}
+
+template<size_t TSize>
+constexpr std::strong_ordering operator<=>(const StaticString<TSize>& lhs, ConstString rhs)
+{
+	return Details::compareBytes(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+}
+
+/* Concatenation, the capacity of the result being the sum of the capacities. ConstString has no such operator,
+ * as its size is not part of its type : append() it to a StaticString of the wanted capacity instead.
+ */
+template<size_t TSize1, size_t TSize2>
+constexpr StaticString<TSize1 + TSize2> operator+(const StaticString<TSize1>& lhs, const StaticString<TSize2>& rhs) noexcept
+{
+	StaticString<TSize1 + TSize2> result;
+	result.append(lhs).append(rhs);
+	return result;
+}
+
+template<size_t TSize1, size_t TSize2>
+constexpr StaticString<TSize1 + TSize2 - 1> operator+(const StaticString<TSize1>& lhs, const char (&rhs)[TSize2]) noexcept
+{
+	StaticString<TSize1 + TSize2 - 1> result;
+	result.append(lhs).append(ConstString{rhs});
+	return result;
+}
+
+template<size_t TSize1, size_t TSize2>
+constexpr StaticString<TSize1 - 1 + TSize2> operator+(const char (&lhs)[TSize1], const StaticString<TSize2>& rhs) noexcept
+{
+	StaticString<TSize1 - 1 + TSize2> result;
+	result.append(ConstString{lhs}).append(rhs);
+	return result;
+}
+
+template<size_t TSize>
+constexpr StaticString<TSize + 1> operator+(const StaticString<TSize>& lhs, char rhs) noexcept
+{
+	StaticString<TSize + 1> result;
+	result.append(lhs).append(rhs);
+	return result;
+}
+
+template<size_t TSize>
+constexpr StaticString<TSize + 1> operator+(char lhs, const StaticString<TSize>& rhs) noexcept
+{
+	StaticString<TSize + 1> result;
+	result.append(lhs).append(rhs);
+	return result;
+}
+
+// Decimal representation of an integer, usable at compile time.
+template<class Integer, std::enable_if_t<Details::is_formattable_integer<Integer>, bool> = true>
+constexpr StaticString<Details::maxIntegerDigits> toStaticString(Integer value) noexcept
+{
+	StaticString<Details::maxIntegerDigits> result;
+	result.append(value);
+	return result;
+}
+
 #endif // STATIC_STRING_HXX
\ No newline at end of file
@@ -0,0 +1,210 @@
+#ifndef STATIC_VECTOR_HXX
+#define STATIC_VECTOR_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <ArrayIteratorPolicy.hxx>
+#include <ConstexprAssert.hxx>
+#include <MetaUtils.hxx>
+#include <Range.hxx>
+
+/* Vector of at most Tcapacity elements, stored inline : small collections, like the enumerators or names gathered
+ * for a request, stay on the stack. Like std::array, the elements are always constructed, the ones past the size
+ * being value initialized, so T must be default constructible. In exchange, a StaticVector is usable in constant
+ * expressions and is trivially copyable when T is. The size is of the smallest type able to hold the capacity.
+ */
+template<class T, size_t Tcapacity>
+class StaticVector
+{
+	using IterPolicy = ArrayIteratorPolicy<StaticVector<T, Tcapacity>>;
+	using SizeType = Meta::smallest_unsigned_t<Tcapacity>;
+
+public:
+	using value_type = T;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using size_type = size_t;
+
+	using iterator = typename IterPolicy::iterator;
+	using reverse_iterator = typename IterPolicy::reverse_iterator;
+	using const_iterator = typename IterPolicy::const_iterator;
+	using const_reverse_iterator = typename IterPolicy::const_reverse_iterator;
+	using unchecked_iterator = typename IterPolicy::unchecked_iterator;
+	using unchecked_const_iterator = typename IterPolicy::unchecked_const_iterator;
+	using unchecked_reverse_iterator = typename IterPolicy::unchecked_reverse_iterator;
+	using unchecked_const_reverse_iterator = typename IterPolicy::unchecked_const_reverse_iterator;
+
+public:
+	constexpr StaticVector() noexcept(std::is_nothrow_default_constructible<T>::value) : elements_{}, size_{0}
+	{}
+
+	constexpr StaticVector(std::initializer_list<T> values) : StaticVector{}
+	{
+		CONSTEXPR_BOUNDS_ASSERT(values.size() <= Tcapacity, "The values do not fit in the StaticVector");
+		for(const T& value : values)
+		{
+			elements_[size_++] = value;
+		}
+	}
+
+	template<class Iterator, class Sentinel>
+	constexpr explicit StaticVector(range<Iterator, Sentinel> values) : StaticVector{}
+	{
+		for(auto it = values.begin(); it != values.end(); ++it)
+		{
+			push_back(*it);
+		}
+	}
+
+	constexpr iterator begin() noexcept { return IterPolicy::makeIterator(*this, 0); }
+	constexpr const_iterator begin() const noexcept { return IterPolicy::makeIterator(*this, 0); }
+	constexpr const_iterator cbegin() const noexcept { return begin(); }
+	constexpr iterator end() noexcept { return IterPolicy::makeIterator(*this, size()); }
+	constexpr const_iterator end() const noexcept { return IterPolicy::makeIterator(*this, size()); }
+	constexpr const_iterator cend() const noexcept { return end(); }
+
+	constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{ end() }; }
+	constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ cend() }; }
+	constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator{ cend() }; }
+	constexpr reverse_iterator rend() noexcept { return reverse_iterator{ begin() }; }
+	constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ cbegin() }; }
+	constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator{ cbegin() }; }
+
+	constexpr T& at(size_t index)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticVector");
+		return elements_[index];
+	}
+
+	constexpr const T& at(size_t index) const
+	{
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Attempt to access a non-existing index of a StaticVector");
+		return elements_[index];
+	}
+
+	constexpr T& operator[](size_t index) { return at(index); }
+	constexpr const T& operator[](size_t index) const { return at(index); }
+
+	constexpr T& front() { return at(0); }
+	constexpr const T& front() const { return at(0); }
+	constexpr T& back() { return at(size() - 1); }
+	constexpr const T& back() const { return at(size() - 1); }
+
+	constexpr T* data() noexcept { return elements_.data(); }
+	constexpr const T* data() const noexcept { return elements_.data(); }
+
+	constexpr size_t size() const noexcept { return size_; }
+	static constexpr size_t capacity() noexcept { return Tcapacity; }
+	constexpr bool empty() const noexcept { return size_ == 0; }
+	constexpr bool full() const noexcept { return size_ == Tcapacity; }
+
+	constexpr void push_back(const T& value)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!full(), "Pushing past the capacity of a StaticVector");
+		elements_[size_++] = value;
+	}
+
+	constexpr void push_back(T&& value)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!full(), "Pushing past the capacity of a StaticVector");
+		elements_[size_++] = std::move(value);
+	}
+
+	template<class... Args>
+	constexpr T& emplace_back(Args&&... args)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!full(), "Pushing past the capacity of a StaticVector");
+		elements_[size_] = T(std::forward<Args>(args)...);
+		return elements_[size_++];
+	}
+
+	constexpr void pop_back()
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!empty(), "Popping an empty StaticVector");
+		--size_;
+		release(size_, size_ + 1);
+	}
+
+	// The elements past the new size are value initialized.
+	constexpr void resize(size_t newSize)
+	{
+		CONSTEXPR_BOUNDS_ASSERT(newSize <= Tcapacity, "Cannot resize a StaticVector past its capacity");
+		if(newSize < size_)
+		{
+			release(newSize, size_);
+		}
+		// The elements already past the size may still hold values they were given before, like after pop_back().
+		for(size_t i = size_; i < newSize; ++i)
+		{
+			elements_[i] = T{};
+		}
+		size_ = static_cast<SizeType>(newSize);
+	}
+
+	constexpr void clear() noexcept(std::is_trivially_destructible<T>::value)
+	{
+		release(0, size_);
+		size_ = 0;
+	}
+
+	// Removes the element at pos, moving the following ones, and returns an iterator to the element after it.
+	constexpr iterator erase(const_iterator pos)
+	{
+		const size_t index = static_cast<size_t>(pos - cbegin());
+		CONSTEXPR_BOUNDS_ASSERT(index < size(), "Erasing a non-existing element of a StaticVector");
+		for(size_t i = index; i + 1 < size_; ++i)
+		{
+			elements_[i] = std::move(elements_[i + 1]);
+		}
+		pop_back();
+		return begin() + index;
+	}
+
+private:
+	// The elements past the size own nothing : the ones owning resources are reset.
+	constexpr void release(size_t first, size_t last)
+	{
+		if constexpr(!std::is_trivially_destructible<T>::value)
+		{
+			// Bounded by the capacity too, which the compiler can not deduce from the size, to prove the accesses valid.
+			for(size_t i = first; i < std::min(last, Tcapacity); ++i)
+			{
+				elements_[i] = T{};
+			}
+		}
+		else
+		{
+			static_cast<void>(first);
+			static_cast<void>(last);
+		}
+	}
+
+	std::array<T, Tcapacity> elements_;
+	SizeType size_;
+};
+
+template<class T, size_t TCapacity1, size_t TCapacity2>
+constexpr bool operator==(const StaticVector<T, TCapacity1>& lhs, const StaticVector<T, TCapacity2>& rhs)
+{
+	if(lhs.size() != rhs.size())
+	{
+		return false;
+	}
+	for(size_t i = 0; i < lhs.size(); ++i)
+	{
+		if(!(lhs.data()[i] == rhs.data()[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif // STATIC_VECTOR_HXX
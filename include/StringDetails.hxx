@@ -1,15 +1,285 @@
 #ifndef STRING_DETAILS_HXX
 #define STRING_DETAILS_HXX
 
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
 namespace Details
 {
-	
-template<class ArrayClass1, class ArrayClass2>
-constexpr bool equalAux(const size_t size, const ArrayClass1& lhs, const ArrayClass2& rhs)
+
+/* Byte string primitives behind the comparisons and searches of ConstString and StaticString.
+ * At runtime they forward to the C library (memcmp, memchr, memrchr), which is vectorized on every
+ * platform that matters, and fall back to plain loops at compile time.
+ */
+
+constexpr bool equalBytes(const char* lhs, const char* rhs, size_t size) noexcept
+{
+	if(!std::is_constant_evaluated())
+	{
+		return size == 0 || std::memcmp(lhs, rhs, size) == 0;
+	}
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		if(lhs[i] != rhs[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+constexpr void copyBytes(char* destination, const char* source, size_t size) noexcept
+{
+	if(!std::is_constant_evaluated())
+	{
+		if(size != 0)
+		{
+			std::memcpy(destination, source, size);
+		}
+		return;
+	}
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		destination[i] = source[i];
+	}
+}
+
+// Lexicographical comparison, bytes being compared as unsigned (as memcmp does).
+constexpr std::strong_ordering compareBytes(const char* lhs, size_t lhsSize, const char* rhs, size_t rhsSize) noexcept
+{
+	const size_t size = lhsSize < rhsSize ? lhsSize : rhsSize;
+
+	if(!std::is_constant_evaluated())
+	{
+		const int result = size == 0 ? 0 : std::memcmp(lhs, rhs, size);
+		if(result != 0)
+		{
+			return result < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+		}
+		return lhsSize <=> rhsSize;
+	}
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		if(lhs[i] != rhs[i])
+		{
+			return static_cast<unsigned char>(lhs[i]) <=> static_cast<unsigned char>(rhs[i]);
+		}
+	}
+	return lhsSize <=> rhsSize;
+}
+
+// Index of the first occurrence of c, or size.
+constexpr size_t findByte(const char* data, size_t size, char c) noexcept
+{
+	if(!std::is_constant_evaluated())
+	{
+		const void* found = size == 0 ? nullptr : std::memchr(data, c, size);
+		return found ? static_cast<const char*>(found) - data : size;
+	}
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		if(data[i] == c)
+		{
+			return i;
+		}
+	}
+	return size;
+}
+
+// Index of the last occurrence of c, or size.
+constexpr size_t findLastByte(const char* data, size_t size, char c) noexcept
+{
+#if defined(__GLIBC__)
+	if(!std::is_constant_evaluated())
+	{
+		const void* found = size == 0 ? nullptr : ::memrchr(data, c, size);
+		return found ? static_cast<const char*>(found) - data : size;
+	}
+#endif
+
+	for(size_t i = size; i != 0; --i)
+	{
+		if(data[i - 1] == c)
+		{
+			return i - 1;
+		}
+	}
+	return size;
+}
+
+constexpr uint64_t byteSwap(uint64_t word) noexcept
+{
+	word = ((word & 0x00FF00FF00FF00FFull) << 8) | ((word >> 8) & 0x00FF00FF00FF00FFull);
+	word = ((word & 0x0000FFFF0000FFFFull) << 16) | ((word >> 16) & 0x0000FFFF0000FFFFull);
+	return (word << 32) | (word >> 32);
+}
+
+// Longest decimal representation of a 64 bits integer, sign included.
+constexpr size_t maxIntegerDigits = 20;
+
+template<class Integer>
+constexpr bool is_formattable_integer = std::is_integral<Integer>::value
+                                     && !std::is_same<Integer, bool>::value
+                                     && !std::is_same<Integer, char>::value
+                                     && sizeof(Integer) <= 8;
+
+/* Write the decimal representation of value at the beginning of buffer (at least maxIntegerDigits long),
+ * and return its length. std::to_chars is not constexpr before C++23, so it is only used at runtime.
+ */
+template<class Integer>
+constexpr size_t formatInteger(char* buffer, Integer value) noexcept
+{
+	if(!std::is_constant_evaluated())
+	{
+		return std::to_chars(buffer, buffer + maxIntegerDigits, value).ptr - buffer;
+	}
+
+	using Unsigned = std::make_unsigned_t<Integer>;
+	Unsigned magnitude = static_cast<Unsigned>(value);
+	size_t size = 0;
+	if constexpr(std::is_signed<Integer>::value)
+	{
+		if(value < 0)
+		{
+			buffer[size++] = '-';
+			magnitude = static_cast<Unsigned>(Unsigned{0} - magnitude);
+		}
+	}
+
+	size_t digits = 1;
+	for(Unsigned rest = magnitude; rest >= 10; rest /= 10)
+	{
+		++digits;
+	}
+	size += digits;
+	for(size_t i = size; i != size - digits; --i, magnitude /= 10)
+	{
+		buffer[i - 1] = static_cast<char>('0' + magnitude % 10);
+	}
+	return size;
+}
+
+/* Load up to 8 bytes as a little endian word, missing bytes being zero.
+ * The result is the same at compile time and at runtime, whatever the platform endianess.
+ */
+constexpr uint64_t loadWord(const char* data, size_t size = 8) noexcept
+{
+	if(!std::is_constant_evaluated())
+	{
+		uint64_t word = 0;
+		std::memcpy(&word, data, size);
+		if constexpr(std::endian::native == std::endian::big)
+		{
+			word = byteSwap(word);
+		}
+		return word;
+	}
+
+	uint64_t word = 0;
+	for(size_t i = 0; i < size; ++i)
+	{
+		word |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+	}
+	return word;
+}
+
+/* Equality of two buffers whose size is known at compile time, compared a word at a time without any early exit.
+ * Meant for fixed size keys whose unused bytes are zeroed, where comparing the whole buffer is cheaper than
+ * branching on the actual size of the strings.
+ */
+template<size_t size>
+constexpr bool equalFixedBytes(const char* lhs, const char* rhs) noexcept
 {
-	return size != 0 ? ((lhs[size - 1] == rhs[size - 1] && equalAux(size - 1, lhs, rhs))) : true;
+	uint64_t difference = 0;
+	size_t i = 0;
+	for(; i + 8 <= size; i += 8)
+	{
+		difference |= loadWord(lhs + i) ^ loadWord(rhs + i);
+	}
+	if constexpr(size % 8 != 0)
+	{
+		difference |= loadWord(lhs + i, size % 8) ^ loadWord(rhs + i, size % 8);
+	}
+	return difference == 0;
+}
+
+/* 64x64 -> 128 bits multiplication, the high half being returned in rhs and the low one in lhs.
+ * This is the building block of wyhash, which our string hash is modeled on.
+ */
+constexpr void multiplyFull(uint64_t& lhs, uint64_t& rhs) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+	const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+	lhs = static_cast<uint64_t>(product);
+	rhs = static_cast<uint64_t>(product >> 64);
+#else
+	const uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<uint32_t>(lhs);
+	const uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<uint32_t>(rhs);
+	const uint64_t high = lhsHigh * rhsHigh, middle0 = lhsHigh * rhsLow, middle1 = lhsLow * rhsHigh, low = lhsLow * rhsLow;
+	const uint64_t cross = (low >> 32) + static_cast<uint32_t>(middle0) + static_cast<uint32_t>(middle1);
+	lhs = (cross << 32) | static_cast<uint32_t>(low);
+	rhs = high + (middle0 >> 32) + (middle1 >> 32) + (cross >> 32);
+#endif
+}
+
+constexpr uint64_t multiplyMix(uint64_t lhs, uint64_t rhs) noexcept
+{
+	multiplyFull(lhs, rhs);
+	return lhs ^ rhs;
+}
+
+/* wyhash style hash of a byte string. It gives the same result at compile time and at runtime, so
+ * hashes computed by the compiler (for instance the enum name hashes) can be compared with runtime ones.
+ */
+constexpr uint64_t hashBytes(const char* data, size_t size, uint64_t seed = 0) noexcept
+{
+	constexpr uint64_t secret0 = 0xa0761d6478bd642full;
+	constexpr uint64_t secret1 = 0xe7037ed1a0b428dbull;
+
+	seed ^= multiplyMix(seed ^ secret0, secret1);
+
+	uint64_t first = 0;
+	uint64_t second = 0;
+	if(size <= 16)
+	{
+		if(size >= 4)
+		{
+			const size_t shift = (size >> 3) << 2;
+			first = (loadWord(data, 4) << 32) | loadWord(data + shift, 4);
+			second = (loadWord(data + size - 4, 4) << 32) | loadWord(data + size - 4 - shift, 4);
+		}
+		else if(size > 0)
+		{
+			first = (static_cast<uint64_t>(static_cast<unsigned char>(data[0])) << 16)
+			      | (static_cast<uint64_t>(static_cast<unsigned char>(data[size >> 1])) << 8)
+			      | static_cast<uint64_t>(static_cast<unsigned char>(data[size - 1]));
+		}
+	}
+	else
+	{
+		for(size_t i = 0; i + 16 < size; i += 16)
+		{
+			seed = multiplyMix(loadWord(data + i) ^ secret1, loadWord(data + i + 8) ^ seed);
+		}
+		first = loadWord(data + size - 16);
+		second = loadWord(data + size - 8);
+	}
+
+	first ^= secret1;
+	second ^= seed;
+	multiplyFull(first, second);
+	return multiplyMix(first ^ secret0 ^ size, second ^ secret1);
 }
 
 }
 
-#endif // STRING_DETAILS_HXX
\ No newline at end of file
+#endif // STRING_DETAILS_HXX
@@ -0,0 +1,52 @@
+#ifndef STRING_HASH_HXX
+#define STRING_HASH_HXX
+
+#include <cstddef>
+#include <functional>
+
+#include <ConstString.hxx>
+#include <StaticString.hxx>
+#include <StringDetails.hxx>
+
+/* Hashing of ConstString and StaticString.
+ * Both hash their content the same way (see Details::hashBytes), at compile time as well as at runtime.
+ * StringHash and StringEqual are transparent, so an unordered container keyed by StaticString (or std::string)
+ * can be searched with a ConstString, or a string literal, without building a temporary key :
+ *     std::unordered_map<StaticString<16>, int, StringHash, StringEqual> map;
+ *     map.find(ConstString{"Foo"});
+ */
+
+struct StringHash
+{
+	using is_transparent = void;
+
+	constexpr size_t operator()(ConstString str) const noexcept
+	{
+		return static_cast<size_t>(Details::hashBytes(str.data(), str.size()));
+	}
+};
+
+struct StringEqual
+{
+	using is_transparent = void;
+
+	constexpr bool operator()(ConstString lhs, ConstString rhs) const noexcept
+	{
+		return lhs == rhs;
+	}
+};
+
+namespace std
+{
+
+template<>
+struct hash<ConstString> : StringHash
+{};
+
+template<size_t Tsize>
+struct hash<StaticString<Tsize>> : StringHash
+{};
+
+}
+
+#endif // STRING_HASH_HXX
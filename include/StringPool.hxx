@@ -0,0 +1,309 @@
+#ifndef STRING_POOL_HXX
+#define STRING_POOL_HXX
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ConstString.hxx>
+#include <StringDetails.hxx>
+
+/* Interning of strings : a StringPool gives a single canonical copy of each distinct string it is given, as an
+ * InternedString. Two InternedString from the same pool are equal if and only if they point to the same copy,
+ * so comparing them, or hashing them, never looks at the characters.
+ *     StringPool& pool = StringPool::global();
+ *     InternedString name = pool.intern(field);
+ *     if(name == pool.intern("Foo")) ...
+ * The names of an IMPROVED_ENUM can be added without being copied : the canonical strings are then the ones of the enum
+ * tables, and their entries, with the hashes of the names, are built at compile time. A pool constructed with
+ * EnumNamesSeed<EnumNames...>{} holds the names of these enums from the start, so they are always the canonical
+ * strings. registerEnum<EnumName>() adds them later, but a name interned before the call keeps the copy it was
+ * given : it should be called before the pool is shared, as for StringPool::global(), which is not seeded.
+ *     StringPool pool{EnumNamesSeed<Color, LogLevel>{}};
+ * Other strings are copied, null terminated, in an arena owned by the pool, and live as long as it does.
+ * Looking a string up never takes a lock, while interning a new string is serialized by a mutex. The hash table is
+ * never modified in place once published : it grows by building a new table, and the old ones are kept until the
+ * pool is destroyed, so that a concurrent reader can never see a freed table.
+ */
+
+namespace Details
+{
+
+struct PoolEntry
+{
+	const char* data;
+	size_t size;
+	uint64_t hash;
+};
+
+// The entries of the names of an IMPROVED_ENUM, pointing to its tables.
+template<class EnumName>
+class EnumPoolEntries
+{
+	static constexpr std::array<PoolEntry, EnumName::size()> build() noexcept
+	{
+		std::array<PoolEntry, EnumName::size()> entries{};
+		for(size_t index = 0; index < entries.size(); ++index)
+		{
+			const ConstString name = EnumName::names()[index];
+			entries[index] = {name.data(), name.size(), EnumName::name_hashes()[index]};
+		}
+		return entries;
+	}
+
+public:
+	static constexpr std::array<PoolEntry, EnumName::size()> entries_ = build();
+};
+
+}
+
+// The enumerations whose names a StringPool holds from its construction.
+template<class ... EnumNames>
+struct EnumNamesSeed
+{};
+
+class InternedString
+{
+public:
+	constexpr InternedString() noexcept : entry_{nullptr}
+	{}
+
+	constexpr explicit InternedString(const Details::PoolEntry* entry) noexcept : entry_{entry}
+	{}
+
+	// Whether the string comes from a pool, or is a default constructed one.
+	constexpr bool valid() const noexcept { return entry_ != nullptr; }
+
+	constexpr const char* data() const noexcept { return valid() ? entry_->data : ""; }
+	constexpr size_t size() const noexcept { return valid() ? entry_->size : 0; }
+	constexpr uint64_t hash() const noexcept { return valid() ? entry_->hash : 0; }
+
+	constexpr ConstString str() const noexcept { return {data(), size()}; }
+
+	constexpr bool operator==(const InternedString& rhs) const noexcept
+	{
+		return entry_ == rhs.entry_;
+	}
+
+	constexpr bool operator!=(const InternedString& rhs) const noexcept
+	{
+		return entry_ != rhs.entry_;
+	}
+
+private:
+	const Details::PoolEntry* entry_;
+};
+
+namespace std
+{
+
+template<>
+struct hash<InternedString>
+{
+	size_t operator()(const InternedString& str) const noexcept
+	{
+		return static_cast<size_t>(str.hash());
+	}
+};
+
+}
+
+class StringPool
+{
+	// Open addressing table of entries, with linear probing. A null slot is empty.
+	struct Table
+	{
+		explicit Table(size_t capacity) : slots{std::make_unique<std::atomic<const Details::PoolEntry*>[]>(capacity)}, capacity{capacity}
+		{}
+
+		std::unique_ptr<std::atomic<const Details::PoolEntry*>[]> slots;
+		size_t capacity;
+	};
+
+	static constexpr size_t initialCapacity = 64;
+	static constexpr size_t chunkSize = 4096;
+
+public:
+	StringPool() : table_{nullptr}, size_{0}, currentChunk_{nullptr}, chunkUsed_{chunkSize}
+	{
+		tables_.push_back(std::make_unique<Table>(initialCapacity));
+		table_.store(tables_.back().get(), std::memory_order_release);
+	}
+
+	template<class ... EnumNames>
+	explicit StringPool(EnumNamesSeed<EnumNames...>) : StringPool{}
+	{
+		(addEntries(Details::EnumPoolEntries<EnumNames>::entries_), ...);
+	}
+
+	StringPool(const StringPool&) = delete;
+	StringPool& operator=(const StringPool&) = delete;
+
+	// Pool shared by the whole program.
+	static StringPool& global()
+	{
+		static StringPool pool;
+		return pool;
+	}
+
+	// The interned string equal to str, or an invalid one if str was never interned. Never locks.
+	InternedString find(ConstString str) const noexcept
+	{
+		return InternedString{lookup(*table_.load(std::memory_order_acquire), str, hashOf(str))};
+	}
+
+	InternedString intern(ConstString str)
+	{
+		const uint64_t hash = hashOf(str);
+		if(const Details::PoolEntry* entry = lookup(*table_.load(std::memory_order_acquire), str, hash))
+		{
+			return InternedString{entry};
+		}
+
+		std::lock_guard<std::mutex> lock{mutex_};
+		// Another thread may have interned it in the meantime.
+		if(const Details::PoolEntry* entry = lookup(*table_.load(std::memory_order_relaxed), str, hash))
+		{
+			return InternedString{entry};
+		}
+		entries_.push_back({store(str), str.size(), hash});
+		return InternedString{publish(&entries_.back())};
+	}
+
+	// Make the names of an IMPROVED_ENUM the canonical strings for their content, without copying them.
+	// Names already interned keep their existing canonical string : see EnumNamesSeed to avoid it.
+	template<class EnumName>
+	void registerEnum()
+	{
+		std::lock_guard<std::mutex> lock{mutex_};
+		addEntries(Details::EnumPoolEntries<EnumName>::entries_);
+	}
+
+	// Number of distinct strings in the pool.
+	size_t size() const noexcept
+	{
+		return size_.load(std::memory_order_relaxed);
+	}
+
+private:
+	static uint64_t hashOf(ConstString str) noexcept
+	{
+		return Details::hashBytes(str.data(), str.size());
+	}
+
+	static const Details::PoolEntry* lookup(const Table& table, ConstString str, uint64_t hash) noexcept
+	{
+		const size_t mask = table.capacity - 1;
+		for(size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+		{
+			const Details::PoolEntry* entry = table.slots[slot].load(std::memory_order_acquire);
+			if(entry == nullptr)
+			{
+				return nullptr;
+			}
+			if(entry->hash == hash && ConstString{entry->data, entry->size} == str)
+			{
+				return entry;
+			}
+		}
+	}
+
+	static void place(Table& table, const Details::PoolEntry* entry) noexcept
+	{
+		const size_t mask = table.capacity - 1;
+		size_t slot = entry->hash & mask;
+		while(table.slots[slot].load(std::memory_order_relaxed) != nullptr)
+		{
+			slot = (slot + 1) & mask;
+		}
+		table.slots[slot].store(entry, std::memory_order_release);
+	}
+
+	// Called with the mutex held, or from a constructor, for entries living as long as the pool.
+	template<size_t Tsize>
+	void addEntries(const std::array<Details::PoolEntry, Tsize>& entries)
+	{
+		for(const Details::PoolEntry& entry : entries)
+		{
+			if(lookup(*table_.load(std::memory_order_relaxed), {entry.data, entry.size}, entry.hash) == nullptr)
+			{
+				publish(&entry);
+			}
+		}
+	}
+
+	// Called with the mutex held, for an entry whose string is not in the pool yet.
+	const Details::PoolEntry* publish(const Details::PoolEntry* entry)
+	{
+		Table* table = table_.load(std::memory_order_relaxed);
+		// The table is kept at most half full, so that probes stay short.
+		if(2 * (size_.load(std::memory_order_relaxed) + 1) > table->capacity)
+		{
+			auto grown = std::make_unique<Table>(table->capacity * 2);
+			// The entries of the enums are not in entries_, so the old table is what lists them all.
+			for(size_t slot = 0; slot < table->capacity; ++slot)
+			{
+				if(const Details::PoolEntry* existing = table->slots[slot].load(std::memory_order_relaxed))
+				{
+					place(*grown, existing);
+				}
+			}
+			place(*grown, entry);
+			tables_.push_back(std::move(grown));
+			table_.store(tables_.back().get(), std::memory_order_release);
+		}
+		else
+		{
+			place(*table, entry);
+		}
+		size_.fetch_add(1, std::memory_order_relaxed);
+		return entry;
+	}
+
+	// Copy the characters in the arena, null terminated. Called with the mutex held.
+	const char* store(ConstString str)
+	{
+		const size_t size = str.size() + 1;
+		char* destination;
+		if(size > chunkSize / 4)
+		{
+			// Big strings get their own chunk, so as not to waste the end of the current one.
+			chunks_.push_back(std::make_unique<char[]>(size));
+			destination = chunks_.back().get();
+		}
+		else
+		{
+			if(chunkUsed_ + size > chunkSize)
+			{
+				chunks_.push_back(std::make_unique<char[]>(chunkSize));
+				currentChunk_ = chunks_.back().get();
+				chunkUsed_ = 0;
+			}
+			destination = currentChunk_ + chunkUsed_;
+			chunkUsed_ += size;
+		}
+		Details::copyBytes(destination, str.data(), str.size());
+		destination[str.size()] = '\0';
+		return destination;
+	}
+
+	std::atomic<Table*> table_;
+	std::atomic<size_t> size_;
+
+	// Everything below is only accessed with the mutex held.
+	std::mutex mutex_;
+	std::vector<std::unique_ptr<Table>> tables_;
+	// The entries of the copied strings. A deque never moves its elements, so entries can be pointed to.
+	std::deque<Details::PoolEntry> entries_;
+	std::vector<std::unique_ptr<char[]>> chunks_;
+	char* currentChunk_;
+	size_t chunkUsed_;
+};
+
+#endif // STRING_POOL_HXX
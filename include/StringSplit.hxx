@@ -0,0 +1,167 @@
+#ifndef STRING_SPLIT_HXX
+#define STRING_SPLIT_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include <ByteSet.hxx>
+#include <ConstexprAssert.hxx>
+#include <ConstString.hxx>
+
+/* Lazy splitting of a ConstString on a set of delimiter bytes.
+ * The fields are ConstString slices of the original string : nothing is copied nor allocated, and the
+ * next delimiter is only searched for when the iterator is incremented. The slices can thus be given
+ * directly to EnumName::from_string() and the like, as long as the split string outlives them.
+ *     for(ConstString field : split(line, ",;"))
+ *         process(LogLevel::from_string(field));
+ * With SplitMode::KeepEmpty (the default, used by split()), n delimiters always give n + 1 fields, some of
+ * them possibly empty. With SplitMode::SkipEmpty (used by tokenize()), empty fields are dropped, so runs of
+ * delimiters act as a single one.
+ */
+
+enum class SplitMode : uint8_t
+{
+	KeepEmpty,
+	SkipEmpty
+};
+
+/* The fields are given by value, as a ConstString is only two words : a reference to a member of the iterator would
+ * dangle once the iterator is incremented or destroyed. The iterator is thus a C++20 forward iterator, but only an
+ * input iterator for the legacy algorithms, which require references.
+ */
+class SplitIterator
+{
+public:
+	using iterator_concept = std::forward_iterator_tag;
+	using iterator_category = std::input_iterator_tag;
+	using value_type = ConstString;
+	using difference_type = ptrdiff_t;
+	using pointer = const ConstString*;
+	using reference = ConstString;
+
+	// End iterator.
+	constexpr SplitIterator() noexcept
+	: delimiters_{nullptr}, next_{nullptr}, end_{nullptr}, current_{nullptr, 0}, mode_{SplitMode::KeepEmpty}, pending_{false}, atEnd_{true}
+	{}
+
+	constexpr SplitIterator(const Details::ByteSet& delimiters, ConstString str, SplitMode mode) noexcept
+	: delimiters_{&delimiters}, next_{str.data()}, end_{str.data() + str.size()}, current_{str.data(), 0}, mode_{mode}, pending_{true}, atEnd_{false}
+	{
+		advance();
+	}
+
+	constexpr reference operator*() const
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!atEnd_, "Attempt to dereference the end of a split");
+		return current_;
+	}
+
+	// Only valid until the iterator is incremented.
+	constexpr pointer operator->() const
+	{
+		CONSTEXPR_BOUNDS_ASSERT(!atEnd_, "Attempt to dereference the end of a split");
+		return &current_;
+	}
+
+	constexpr SplitIterator& operator++() noexcept
+	{
+		advance();
+		return *this;
+	}
+
+	constexpr SplitIterator operator++(int) noexcept
+	{
+		SplitIterator tmp{*this};
+		advance();
+		return tmp;
+	}
+
+	constexpr bool operator==(const SplitIterator& rhs) const noexcept
+	{
+		return atEnd_ == rhs.atEnd_ && (atEnd_ || (current_.data() == rhs.current_.data() && current_.size() == rhs.current_.size()));
+	}
+
+	constexpr bool operator!=(const SplitIterator& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	// The part of the string not split yet, after the current field and its delimiter.
+	constexpr ConstString remainder() const noexcept
+	{
+		return {next_, pending_ ? static_cast<size_t>(end_ - next_) : 0};
+	}
+
+private:
+	constexpr void advance() noexcept
+	{
+		while(pending_)
+		{
+			const size_t size = end_ - next_;
+			const size_t cut = delimiters_->findFirstOf(next_, size);
+
+			current_ = ConstString{next_, cut};
+			pending_ = cut != size;
+			next_ += pending_ ? cut + 1 : size;
+
+			if(mode_ == SplitMode::KeepEmpty || cut != 0)
+			{
+				return;
+			}
+		}
+		atEnd_ = true;
+	}
+
+	const Details::ByteSet* delimiters_;
+	const char* next_;
+	const char* end_;
+	ConstString current_;
+	SplitMode mode_;
+	// Whether there is still a field after the current one.
+	bool pending_;
+	bool atEnd_;
+};
+
+// Owns the delimiter set, so its iterators are only valid as long as the view is alive.
+class SplitView
+{
+public:
+	using iterator = SplitIterator;
+	using const_iterator = SplitIterator;
+	using value_type = ConstString;
+
+	constexpr SplitView(ConstString str, ConstString delimiters, SplitMode mode = SplitMode::KeepEmpty) noexcept
+	: str_{str}, delimiters_{delimiters}, mode_{mode}
+	{}
+
+	constexpr iterator begin() const noexcept { return {delimiters_, str_, mode_}; }
+	constexpr iterator end() const noexcept { return {}; }
+
+	constexpr bool empty() const noexcept
+	{
+		return begin() == end();
+	}
+
+	constexpr ConstString front() const
+	{
+		return *begin();
+	}
+
+private:
+	ConstString str_;
+	Details::ByteSet delimiters_;
+	SplitMode mode_;
+};
+
+constexpr SplitView split(ConstString str, ConstString delimiters) noexcept
+{
+	return {str, delimiters, SplitMode::KeepEmpty};
+}
+
+constexpr SplitView tokenize(ConstString str, ConstString delimiters) noexcept
+{
+	return {str, delimiters, SplitMode::SkipEmpty};
+}
+
+#endif // STRING_SPLIT_HXX
@@ -1,10 +1,17 @@
+#include <algorithm>
 #include <array>
+#include <ranges>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <mettle/header_only.hpp>
 using namespace mettle;
 
 #include <ConstString.hxx>
+#include <StaticString.hxx>
+#include <StringHash.hxx>
 
 suite<> constStringSuite("Testing suite for ConstString", [](auto& _){
 	_.test("Testing construction from literal string", []() {
@@ -62,6 +69,62 @@ suite<> constStringSuite("Testing suite for ConstString", [](auto& _){
 		expect(*findit, equal_to('A'));
 	});
 	
+	_.test("Test find method on a missing character", []() {
+		ConstString str = "No such character";
+		
+		expect(str.find('z') == str.end(), equal_to(true));
+		ConstString empty = "";
+		expect(empty.find('a') == empty.end(), equal_to(true));
+		static constexpr ConstString keyword = "constexpr";
+		static_assert(keyword.find('x') - keyword.begin() == 6, "");
+	});
+	
+	_.test("Test comparison of long strings", []() {
+		std::string long1(300, 'a');
+		std::string long2 = long1;
+		long2.back() = 'b';
+		
+		expect(ConstString{long1} == ConstString{long1}, equal_to(true));
+		expect(ConstString{long1} == ConstString{long2}, equal_to(false));
+		expect(ConstString{long1} < ConstString{long2}, equal_to(true));
+	});
+	
+	_.test("Test three-way comparison", []() {
+		ConstString foo = "Foo";
+		ConstString foobar = "FooBar";
+		ConstString bar = "Bar";
+		ConstString high = "\xE9";
+		
+		expect((foo <=> foobar) < 0, equal_to(true));
+		expect((foo <=> bar) > 0, equal_to(true));
+		expect((foo <=> ConstString{"Foo"}) == 0, equal_to(true));
+		// Bytes are compared as unsigned, whatever the signedness of char.
+		expect(bar < high, equal_to(true));
+		static_assert((ConstString{"abc"} <=> ConstString{"abd"}) < 0, "");
+		static_assert(ConstString{"\xE9"} > ConstString{"z"}, "");
+	});
+	
+	_.test("Test sorting names", []() {
+		std::vector<ConstString> names{"Warning", "Error", "Info", "Debug", "ErrorCount"};
+		std::sort(names.begin(), names.end());
+		
+		expect(std::is_sorted(names.begin(), names.end()), equal_to(true));
+		expect(names.front() == ConstString{"Debug"}, equal_to(true));
+		expect(names[2] == ConstString{"ErrorCount"}, equal_to(true));
+	});
+	
+	_.test("Test StaticString search and comparison", []() {
+		StaticString<16> str{"a.b.c"};
+		
+		expect(*str.find('.'), equal_to('.'));
+		expect(str.find('.') - str.begin(), equal_to(1));
+		expect(*str.findLastOf('.'), equal_to('.'));
+		expect(str.findLastOf('.') == str.rbegin() + 1, equal_to(true));
+		expect(str.findLastOf('x') == str.rend(), equal_to(true));
+		expect(StaticString<4>{"abc"} < StaticString<8>{"abd"}, equal_to(true));
+		expect((str <=> ConstString{"a.b.c"}) == 0, equal_to(true));
+	});
+	
 	_.test("Test size validity", []() {
 		ConstString str1 = "Foo";
 		ConstString str2 = "Hello world !";
@@ -79,4 +142,60 @@ suite<> constStringSuite("Testing suite for ConstString", [](auto& _){
 		expect(data[2], equal_to('o'));
 		expect(data[3], equal_to('\0'));
 	});
-});
\ No newline at end of file
+	
+	_.test("Test hash is the same at compile time and at runtime", []() {
+		constexpr size_t hash = std::hash<ConstString>{}("A name long enough to need several blocks");
+		std::string runtime{"A name long enough to need several blocks"};
+		
+		expect(std::hash<ConstString>{}(runtime), equal_to(hash));
+		expect(std::hash<ConstString>{}("Foo"), equal_to(std::hash<StaticString<3>>{}(StaticString<3>{"Foo"})));
+		expect(std::hash<ConstString>{}("Foo") != std::hash<ConstString>{}("Fop"), equal_to(true));
+		expect(std::hash<ConstString>{}("") != std::hash<ConstString>{}(std::string{"\0", 1}), equal_to(true));
+	});
+	
+	_.test("Test heterogeneous lookup in unordered containers", []() {
+		std::unordered_map<StaticString<8>, int, StringHash, StringEqual> map;
+		map.emplace(StaticString<8>{"Foo"}, 1);
+		map.emplace(StaticString<8>{"Bar"}, 2);
+		
+		auto found = map.find(ConstString{"Bar"});
+		expect(found != map.end(), equal_to(true));
+		expect(found->second, equal_to(2));
+		expect(map.find(ConstString{"Baz"}) == map.end(), equal_to(true));
+	});
+	
+	_.test("Test reverse iterator distance", []() {
+		ConstString str = "Hello";
+		
+		expect(str.rend() - str.rbegin(), equal_to(5));
+		expect(std::distance(str.rbegin(), str.rend()), equal_to(5));
+		expect(std::string(str.rbegin(), str.rend()), equal_to("olleH"));
+		
+		auto it = str.rbegin();
+		it += 2;
+		expect(*it, equal_to('l'));
+		expect(it[1], equal_to('e'));
+	});
+	
+	_.test("Test ranges algorithms", []() {
+		ConstString str = "Hello";
+		
+		static_assert(std::ranges::random_access_range<ConstString>, "");
+		expect(std::ranges::find(str, 'l') - str.begin(), equal_to(2));
+		expect(std::ranges::count(str, 'l'), equal_to(2));
+	});
+	
+	_.test("Test drop", []() {
+		ConstString str = "Hello";
+		
+		expect(std::string(str.drop(2)), equal_to("llo"));
+		expect(std::string(str.drop(str.begin() + 4)), equal_to("o"));
+		expect(std::string(*str.try_drop(1)), equal_to("ello"));
+		expect(str.try_drop(5).has_value(), equal_to(false));
+		expect(str.try_drop(str.end()).has_value(), equal_to(false));
+		static_assert(ConstString{"abc"}.drop(1) == ConstString{"bc"}, "");
+#if CONSTEXPR_EXCEPTIONS
+		expect([&]() { str.drop(5); }, thrown<std::out_of_range>());
+#endif
+	});
+});
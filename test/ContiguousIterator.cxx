@@ -0,0 +1,121 @@
+// The default iterators, the pointers, are tested here whatever the flags of the build.
+#undef ARRAY_ITERATOR_CHECKED
+#define ARRAY_ITERATOR_CHECKED 0
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <type_traits>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ConstString.hxx>
+#include <ImprovedEnum.hxx>
+#include <StaticString.hxx>
+
+IMPROVED_ENUM(ContiguousEnumTst, uint8_t,
+	First,
+	Second,
+	Third
+);
+
+namespace
+{
+
+using String = StaticString<16>;
+using EnumIterable = decltype(ContiguousEnumTst::iter());
+
+// Not a range of the library : it is not made borrowed by the specialization for the enum ranges.
+struct ForeignRange
+{
+	using is_borrowed_range = std::true_type;
+	int* begin() const { return nullptr; }
+	int* end() const { return nullptr; }
+};
+
+static_assert(std::is_same<String::iterator, char*>::value, "");
+static_assert(std::is_same<ConstString::const_iterator, const char*>::value, "");
+static_assert(std::contiguous_iterator<String::iterator>, "");
+static_assert(std::contiguous_iterator<String::const_iterator>, "");
+static_assert(std::contiguous_iterator<ConstString::const_iterator>, "");
+static_assert(std::contiguous_iterator<String::unchecked_const_iterator>, "");
+static_assert(std::random_access_iterator<String::reverse_iterator>, "");
+static_assert(std::random_access_iterator<ConstString::const_reverse_iterator>, "");
+static_assert(std::ranges::contiguous_range<String>, "");
+static_assert(std::ranges::contiguous_range<const String>, "");
+static_assert(std::ranges::contiguous_range<ConstString>, "");
+static_assert(std::ranges::random_access_range<EnumIterable>, "");
+static_assert(std::ranges::borrowed_range<EnumIterable>, "");
+static_assert(!std::ranges::borrowed_range<ForeignRange>, "");
+static_assert(std::sized_sentinel_for<String::const_iterator, String::iterator>, "");
+
+constexpr size_t countLetter(ConstString str, char c)
+{
+	return static_cast<size_t>(std::ranges::count(str, c));
+}
+
+}
+
+suite<> contiguousIteratorSuite("Testing suite for the contiguous iterators", [](auto& _){
+	_.test("Iterators are the underlying pointers", []() {
+		String str{"Hello"};
+		const String& cref = str;
+
+		expect(std::to_address(str.begin()) == str.data(), equal_to(true));
+		expect(std::to_address(cref.end()) == str.data() + 5, equal_to(true));
+		expect(&str.rbegin()[0] == str.data() + 4, equal_to(true));
+		// Iterators over two copies of the same ConstString compare equal, as they point to the same characters.
+		ConstString a = "Foo";
+		ConstString b = a;
+		expect(a.begin() == b.begin(), equal_to(true));
+	});
+
+	_.test("Random access arithmetic", []() {
+		ConstString str = "abcdef";
+		auto it = str.begin() + 2;
+
+		expect(*it, equal_to('c'));
+		expect(it[1], equal_to('d'));
+		expect(*(2 + str.begin()), equal_to('c'));
+		expect(str.end() - it, equal_to(4));
+		expect(it < str.end(), equal_to(true));
+		expect(it >= str.begin(), equal_to(true));
+
+		auto rit = str.rbegin() + 1;
+		expect(*rit, equal_to('e'));
+		expect(str.rend() - rit, equal_to(5));
+		expect(rit > str.rbegin(), equal_to(true));
+	});
+
+	_.test("Standard algorithms and ranges", []() {
+		String src{"Hello world"};
+		String dst;
+		dst.resize(src.size());
+
+		std::copy(src.begin(), src.end(), dst.begin());
+		expect(dst == ConstString{"Hello world"}, equal_to(true));
+
+		std::ranges::reverse(dst);
+		expect(dst == ConstString{"dlrow olleH"}, equal_to(true));
+
+		expect(std::ranges::find(src, 'w') - src.begin(), equal_to(6));
+		expect(std::string(src.rbegin(), src.rend()), equal_to("dlrow olleH"));
+
+		auto upper = src | std::views::transform([](char c) { return static_cast<char>(c == 'o' ? 'O' : c); });
+		expect(std::string(upper.begin(), upper.end()), equal_to("HellO wOrld"));
+	});
+
+	_.test("Enum iteration", []() {
+		expect(std::ranges::distance(ContiguousEnumTst::iter()), equal_to(3));
+		auto it = std::ranges::find(ContiguousEnumTst::iter(), ContiguousEnumTst{ContiguousEnumTst::Second});
+		expect(*it == ContiguousEnumTst::Second, equal_to(true));
+	});
+
+	_.test("Constant evaluation", []() {
+		static_assert(countLetter("abracadabra", 'a') == 5, "");
+		static_assert(ConstString{"abc"}.end() - ConstString{"abc"}.begin() == 3, "");
+	});
+});
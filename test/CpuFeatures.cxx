@@ -0,0 +1,53 @@
+#include <string>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ByteSet.hxx>
+#include <CpuFeatures.hxx>
+
+suite<> cpuFeaturesSuite("Testing suite for the CPU feature detection", [](auto& _){
+	_.test("Detection", []() {
+		const Details::CpuFeatures& features = Details::cpuFeatures();
+		expect(&features == &Details::cpuFeatures(), equal_to(true));
+#if CPU_DISPATCH && COMPILER != MSVC_COMPILER
+		expect(features.ssse3, equal_to(__builtin_cpu_supports("ssse3") != 0));
+		expect(features.avx2, equal_to(__builtin_cpu_supports("avx2") != 0));
+		expect(features.avx512bw, equal_to(__builtin_cpu_supports("avx512bw") != 0));
+#endif
+		// Every machine supporting a set supports the narrower ones.
+		expect(!features.avx512bw || features.avx2, equal_to(true));
+		expect(!features.avx2 || features.ssse3, equal_to(true));
+	});
+
+	_.test("Dispatched kernels", []() {
+		const Details::ByteSet separators{ConstString{",;\x80"}};
+		std::string text(300, 'a');
+		for(size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 64, 300})
+		{
+			for(size_t position = 0; position <= size; position += 3)
+			{
+				std::string buffer = text;
+				if(position < size)
+				{
+					buffer[position] = position % 2 ? ';' : '\x80';
+				}
+				const size_t expected = separators.findFirstOfFrom(buffer.data(), 0, size);
+				expect(expected, equal_to(position < size ? position : size));
+				expect(separators.findFirstOf(buffer.data(), size), equal_to(expected));
+#if BYTE_SET_SSSE3
+				if(Details::cpuFeatures().ssse3)
+				{
+					expect(separators.findFirstOfSsse3(buffer.data(), size), equal_to(expected));
+				}
+#endif
+#if BYTE_SET_AVX2
+				if(Details::cpuFeatures().avx2)
+				{
+					expect(separators.findFirstOfAvx2(buffer.data(), size), equal_to(expected));
+				}
+#endif
+			}
+		}
+	});
+});
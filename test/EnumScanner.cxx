@@ -0,0 +1,86 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ImprovedEnum.hxx>
+#include <EnumScanner.hxx>
+
+IMPROVED_ENUM(ScannerEnumTst, size_t,
+	Error,
+	IoError,
+	Timeout = 12,
+	Time,
+	Connecting
+);
+
+using ScannerHits = std::vector<std::pair<size_t, std::string>>;
+
+template<class Scanner>
+void scanInto(Scanner& scanner, ConstString chunk, ScannerHits& hits)
+{
+	scanner.scan(chunk, [&hits](size_t offset, ScannerEnumTst value) {
+		hits.emplace_back(offset, std::string{value.to_string()});
+	});
+}
+
+suite<> enumScannerSuite("Testing suite for EnumUtils::Scanner", [](auto& _){
+	_.test("Names table of the enumeration", []() {
+		expect(ScannerEnumTst::names()[0], equal_to(std::string{"Error"}));
+		expect(ScannerEnumTst::names()[2], equal_to(std::string{"Timeout"}));
+		expect(ScannerEnumTst::names()[4], equal_to(std::string{"Connecting"}));
+	});
+
+	_.test("Find every name in a single chunk", []() {
+		EnumUtils::Scanner<ScannerEnumTst> scanner;
+		ScannerHits hits;
+
+		scanInto(scanner, "[Connecting] Timeout, then Error", hits);
+
+		expect(hits, equal_to(ScannerHits{{1, "Connecting"}, {13, "Time"}, {13, "Timeout"}, {27, "Error"}}));
+		expect(scanner.offset(), equal_to(32));
+	});
+
+	_.test("Overlapping names are all reported", []() {
+		EnumUtils::Scanner<ScannerEnumTst> scanner;
+		ScannerHits hits;
+
+		scanInto(scanner, "IoErrorError", hits);
+
+		expect(hits, equal_to(ScannerHits{{0, "IoError"}, {2, "Error"}, {7, "Error"}}));
+	});
+
+	_.test("Match spanning several chunks", []() {
+		EnumUtils::Scanner<ScannerEnumTst> scanner;
+		ScannerHits hits;
+
+		scanInto(scanner, "xx Conn", hits);
+		scanInto(scanner, "ec", hits);
+		scanInto(scanner, "ting Io", hits);
+		scanInto(scanner, "Error", hits);
+
+		expect(hits, equal_to(ScannerHits{{3, "Connecting"}, {14, "IoError"}, {16, "Error"}}));
+	});
+
+	_.test("No match in unrelated text", []() {
+		EnumUtils::Scanner<ScannerEnumTst> scanner;
+		ScannerHits hits;
+
+		scanInto(scanner, "error timeout connecting Tim Erro", hits);
+
+		expect(hits.empty(), equal_to(true));
+	});
+
+	_.test("Reset forget the partial match", []() {
+		EnumUtils::Scanner<ScannerEnumTst> scanner;
+		ScannerHits hits;
+
+		scanInto(scanner, "Tim", hits);
+		scanner.reset();
+		scanInto(scanner, "eout Error", hits);
+
+		expect(hits, equal_to(ScannerHits{{5, "Error"}}));
+	});
+});
@@ -0,0 +1,154 @@
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <EnumSerialization.hxx>
+#include <ImprovedEnum.hxx>
+
+IMPROVED_ENUM(SerialCodeTst, uint32_t,
+	Ok = 0x01020304,
+	Retry = 0x0A0B0C0D,
+	Fatal = 0xF0E0D0C0
+);
+
+IMPROVED_ENUM(SerialStepTst, int16_t,
+	Backward = -1,
+	Stay,
+	Forward
+);
+
+IMPROVED_ENUM(SerialWideTst, uint64_t,
+	Small = 1,
+	Large = 0x0102030405060708
+);
+
+IMPROVED_ENUM(SerialByteTst, uint8_t,
+	A = 3,
+	B = 7,
+	C = 200
+);
+
+namespace
+{
+
+template<class Enum>
+std::vector<Enum> sample(size_t size)
+{
+	std::vector<Enum> values(size);
+	for(size_t i = 0; i < size; ++i)
+	{
+		values[i] = Enum::values()[(i * 7 + i / 3) % Enum::size()];
+	}
+	return values;
+}
+
+template<class Enum, Endianess order>
+bool roundTrips(size_t size)
+{
+	const std::vector<Enum> values = sample<Enum>(size);
+	std::vector<std::byte> buffer(EnumUtils::encodedSize<Enum>(size));
+	EnumUtils::encode<order>(values, buffer.data());
+
+	// Byte after byte, as the other host would write them.
+	constexpr size_t width = sizeof(typename Enum::underlying_type);
+	for(size_t i = 0; i < size; ++i)
+	{
+		using Unsigned = std::make_unsigned_t<typename Enum::underlying_type>;
+		const auto value = static_cast<Unsigned>(values[i].to_value());
+		for(size_t j = 0; j < width; ++j)
+		{
+			const size_t shift = (order == Endianess::big ? width - 1 - j : j) * 8;
+			if(buffer[i * width + j] != static_cast<std::byte>(static_cast<uint64_t>(value) >> shift))
+			{
+				return false;
+			}
+		}
+	}
+
+	std::vector<Enum> decoded(size);
+	return EnumUtils::decode<order>(buffer.data(), decoded) == size && decoded == values;
+}
+
+template<class Enum>
+bool roundTripsAllSizes()
+{
+	bool result = true;
+	for(size_t size : {0, 1, 3, 7, 8, 15, 16, 17, 31, 64, 255, 256, 257, 1000})
+	{
+		result = result && roundTrips<Enum, Endianess::big>(size) && roundTrips<Enum, Endianess::little>(size);
+	}
+	return result;
+}
+
+}
+
+suite<> enumSerializationSuite("Testing suite for the enum serialization", [](auto& _){
+	_.test("Round trips", []() {
+		expect(roundTripsAllSizes<SerialCodeTst>(), equal_to(true));
+		expect(roundTripsAllSizes<SerialStepTst>(), equal_to(true));
+		expect(roundTripsAllSizes<SerialWideTst>(), equal_to(true));
+		expect(roundTripsAllSizes<SerialByteTst>(), equal_to(true));
+	});
+
+	_.test("Byte order known at runtime", []() {
+		const std::array<SerialCodeTst, 2> values{{SerialCodeTst::Ok, SerialCodeTst::Fatal}};
+		std::array<std::byte, 8> buffer{};
+		EnumUtils::encode(values, buffer.data(), Endianess::big);
+		expect(buffer[0], equal_to(std::byte{0x01}));
+		expect(buffer[4], equal_to(std::byte{0xF0}));
+
+		std::array<SerialCodeTst, 2> decoded{};
+		expect(EnumUtils::decode(buffer.data(), decoded, Endianess::big), equal_to(2));
+		expect(decoded == values, equal_to(true));
+		expect(EnumUtils::decode(buffer.data(), decoded, Endianess::little), equal_to(0));
+	});
+
+	_.test("Invalid values", []() {
+		for(size_t position : {0, 5, 255, 256, 600, 999})
+		{
+			std::vector<SerialStepTst> values = sample<SerialStepTst>(1000);
+			std::vector<std::byte> buffer(EnumUtils::encodedSize<SerialStepTst>(values.size()));
+			EnumUtils::encode<Endianess::big>(values, buffer.data());
+			buffer[position * 2] = std::byte{0x12};
+
+			std::vector<SerialStepTst> decoded(values.size());
+			expect(EnumUtils::decode<Endianess::big>(buffer.data(), decoded), equal_to(position));
+		}
+
+		const std::array<std::byte, 3> bytes{{std::byte{3}, std::byte{200}, std::byte{4}}};
+		std::array<SerialByteTst, 3> decoded{};
+		expect(EnumUtils::decode<Endianess::big>(bytes.data(), decoded), equal_to(2));
+	});
+
+	_.test("Byte swap kernels", []() {
+		std::vector<unsigned char> in(203);
+		for(size_t i = 0; i < in.size(); ++i)
+		{
+			in[i] = static_cast<unsigned char>(i);
+		}
+		std::vector<unsigned char> expected(200), out(200);
+		Details::swapBytesScalar<4>(in.data(), expected.data(), 50);
+		expect(expected[0], equal_to(3));
+		expect(expected[7], equal_to(4));
+#if CPU_DISPATCH
+		if(Details::cpuFeatures().ssse3)
+		{
+			Details::swapBytesSsse3<4>(in.data(), out.data(), 50);
+			expect(out, equal_to(expected));
+		}
+		if(Details::cpuFeatures().avx2)
+		{
+			Details::swapBytesAvx2<4>(in.data(), out.data(), 50);
+			expect(out, equal_to(expected));
+		}
+		if(Details::cpuFeatures().avx512bw)
+		{
+			Details::swapBytesAvx512<4>(in.data(), out.data(), 50);
+			expect(out, equal_to(expected));
+		}
+#endif
+	});
+});
@@ -0,0 +1,140 @@
+#include <map>
+#include <memory>
+#include <string>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <FixedStringMap.hxx>
+
+suite<> fixedStringMapSuite("Testing suite for FixedStringMap", [](auto& _){
+	_.test("Insertion and lookup", []() {
+		FixedStringMap<8, int> map;
+		expect(map.empty(), equal_to(true));
+		expect(map.find("Foo") == map.end(), equal_to(true));
+
+		expect(map.try_emplace("Foo", 1).second, equal_to(true));
+		expect(map.try_emplace("Bar", 2).second, equal_to(true));
+		expect(map.try_emplace("Foo", 3).second, equal_to(false));
+		map["FooBar"] = 4;
+
+		expect(map.size(), equal_to(3));
+		expect(map.find("Foo")->second, equal_to(1));
+		expect(map.find(ConstString{"Bar"}).value(), equal_to(2));
+		expect(map["FooBar"], equal_to(4));
+		expect(map.contains(std::string{"Bar"}), equal_to(true));
+		expect(map.contains("Baz"), equal_to(false));
+	});
+
+	_.test("Keys are compared on their whole content", []() {
+		FixedStringMap<16, int> map;
+		map["a"] = 1;
+		map[ConstString{"a\0", 2}] = 2;
+		map["ab"] = 3;
+
+		expect(map.size(), equal_to(3));
+		expect(map["a"], equal_to(1));
+		expect(map[ConstString{"a\0", 2}], equal_to(2));
+		expect(map.contains(""), equal_to(false));
+		// Too long to be a key, so it cannot be in the map.
+		expect(map.contains("This key is much too long"), equal_to(false));
+	});
+
+	_.test("Insert or assign", []() {
+		FixedStringMap<8, std::string> map;
+		expect(map.insert_or_assign("Foo", "first").second, equal_to(true));
+		expect(map.insert_or_assign("Foo", "second").second, equal_to(false));
+		expect(map["Foo"], equal_to("second"));
+	});
+
+	_.test("Growth and erasure against std::map", []() {
+		FixedStringMap<12, size_t> map;
+		std::map<std::string, size_t> reference;
+		for(size_t i = 0; i < 2000; ++i)
+		{
+			const std::string key = "key" + std::to_string(i * 7919 % 3001);
+			map[key] = i;
+			reference[key] = i;
+			if(i % 3 == 0)
+			{
+				const std::string erased = "key" + std::to_string(i * 31 % 3001);
+				expect(map.erase(erased), equal_to(reference.erase(erased)));
+			}
+		}
+
+		expect(map.size(), equal_to(reference.size()));
+		for(const auto& [key, value] : reference)
+		{
+			auto it = map.find(key);
+			expect(it != map.end(), equal_to(true));
+			expect(it->second, equal_to(value));
+		}
+
+		size_t visited = 0;
+		for(auto [key, value] : map)
+		{
+			expect(reference.at(std::string{key.data(), key.size()}), equal_to(value));
+			++visited;
+		}
+		expect(visited, equal_to(reference.size()));
+	});
+
+	_.test("Erase through an iterator and clear", []() {
+		FixedStringMap<8, int> map;
+		for(int i = 0; i < 100; ++i)
+		{
+			map[std::to_string(i)] = i;
+		}
+
+		size_t remaining = 0;
+		for(auto it = map.begin(); it != map.end(); )
+		{
+			if(it.value() % 2 == 0)
+			{
+				it = map.erase(it);
+			}
+			else
+			{
+				++remaining;
+				++it;
+			}
+		}
+		expect(remaining, equal_to(50));
+		expect(map.size(), equal_to(50));
+		expect(map.contains("42"), equal_to(false));
+		expect(map.contains("43"), equal_to(true));
+
+		map.clear();
+		expect(map.empty(), equal_to(true));
+		expect(map.begin() == map.end(), equal_to(true));
+		map["7"] = 7;
+		expect(map["7"], equal_to(7));
+	});
+
+	_.test("Copy and move", []() {
+		FixedStringMap<8, std::unique_ptr<int>> map;
+		map.try_emplace("Foo", std::make_unique<int>(4));
+
+		FixedStringMap<8, std::unique_ptr<int>> moved{std::move(map)};
+		expect(map.empty(), equal_to(true));
+		expect(*moved["Foo"], equal_to(4));
+
+		FixedStringMap<8, std::string> strings;
+		strings["Foo"] = "Bar";
+		FixedStringMap<8, std::string> copy{strings};
+		copy["Foo"] = "Baz";
+		expect(strings["Foo"], equal_to("Bar"));
+		expect(copy["Foo"], equal_to("Baz"));
+	});
+
+	_.test("Reserve", []() {
+		FixedStringMap<8, int> map{100};
+		const size_t capacity = map.capacity();
+		expect(capacity >= 100, equal_to(true));
+		for(int i = 0; i < 100; ++i)
+		{
+			map[std::to_string(i)] = i;
+		}
+		expect(map.capacity(), equal_to(capacity));
+	});
+});
@@ -1,8 +1,14 @@
 #ifndef ENUM_UTILS_TEST_HXX
 #define ENUM_UTILS_TEST_HXX
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <string>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <mettle/header_only.hpp>
 using namespace mettle;
@@ -77,6 +83,48 @@ IMPROVED_ENUM(ImprovedEnumTst3, size_t,
 	Test5
 );
 
+IMPROVED_ENUM(ConnectionStateTst, uint8_t,
+	Idle,
+	Connecting,
+	Connected,
+	Closing,
+	Closed,
+	Close
+);
+
+IMPROVED_ENUM(LogLevelTst, int,
+	Error,
+	Warning,
+	Info,
+	Debug,
+	AVeryLongEnumeratorNameToCheckBlockComparisons
+);
+
+// Contiguous from a negative value, so that the values far past its end do not fit in the difference to its first.
+IMPROVED_ENUM(OffsetTst, int64_t,
+	Below = -2,
+	Zero,
+	Above
+);
+
+// Never looked up ignoring case, so allowed to have names differing only by case.
+IMPROVED_ENUM(CaseCollisionTst, int,
+	Value,
+	VALUE
+);
+
+// Character underlying types, whose values are formatted as numbers.
+IMPROVED_ENUM(CharTst, char,
+	A,
+	B = 'x',
+	C
+);
+
+IMPROVED_ENUM(WideCharTst, wchar_t,
+	A,
+	B
+);
+
 using IteratableEnumTestList = 
 	std::tuple<
 		IterableEnumTst1,
@@ -402,4 +450,222 @@ class EnumTestRunner
 
 EnumTestRunner<IteratableEnumTestList, improvedEnumTestList> runner{};
 
-#endif // ENUM_UTILS_TEST_HXX
\ No newline at end of file
+suite<> prefixMatchSuite("Testing suite for enum name prefix matching", [](auto& _){
+	_.test("Unique abbreviation", []() {
+		auto match = ConnectionStateTst::match_prefix("Connecti");
+
+		expect(match.is_unique(), equal_to(true));
+		expect(match.value() == ConnectionStateTst::Connecting, equal_to(true));
+		expect(match.size(), equal_to(1));
+	});
+
+	_.test("Ambiguous abbreviation gives every candidate, sorted by name", []() {
+		auto match = ConnectionStateTst::match_prefix("Conn");
+		std::vector<std::string> candidates;
+		for(auto value : match.candidates())
+		{
+			candidates.emplace_back(value.to_string());
+		}
+
+		expect(match.is_ambiguous(), equal_to(true));
+		expect(candidates, equal_to(std::vector<std::string>{"Connected", "Connecting"}));
+	});
+
+	_.test("Exact name is unique even if it prefixes other names", []() {
+		auto match = ConnectionStateTst::match_prefix("Close");
+
+		expect(match.is_unique(), equal_to(true));
+		expect(match.value() == ConnectionStateTst::Close, equal_to(true));
+		expect(match.size(), equal_to(2));
+	});
+
+	_.test("Unknown prefix", []() {
+		expect(ConnectionStateTst::match_prefix("Open").empty(), equal_to(true));
+		expect(ConnectionStateTst::match_prefix("Idler").empty(), equal_to(true));
+		expect(ConnectionStateTst::match_prefix("A").empty(), equal_to(true));
+		expect(ConnectionStateTst::match_prefix("Z").empty(), equal_to(true));
+	});
+
+	_.test("Empty prefix matches every name", []() {
+		auto match = ConnectionStateTst::match_prefix("");
+
+		expect(match.is_ambiguous(), equal_to(true));
+		expect(match.size(), equal_to(ConnectionStateTst::size()));
+	});
+
+	_.test("Prefix matching at compile time", []() {
+		static_assert(ConnectionStateTst::match_prefix("Id").value() == ConnectionStateTst::Idle, "");
+		static_assert(ConnectionStateTst::match_prefix("Clos").size() == 3, "");
+	});
+});
+
+suite<> fromStringSuite("Testing suite for enum construction from a name", [](auto& _){
+	_.test("Case sensitive lookup", []() {
+		expect(LogLevelTst::from_string("Error") == LogLevelTst::Error, equal_to(true));
+		expect(LogLevelTst::from_string(std::string{"Debug"}) == LogLevelTst::Debug, equal_to(true));
+		expect(CaseCollisionTst::from_string("VALUE") == CaseCollisionTst::VALUE, equal_to(true));
+	});
+
+	_.test("Case insensitive lookup", []() {
+		using EnumUtils::StringCase;
+
+		expect(LogLevelTst::from_string<StringCase::Insensitive>("error") == LogLevelTst::Error, equal_to(true));
+		expect(LogLevelTst::from_string<StringCase::Insensitive>("ERROR") == LogLevelTst::Error, equal_to(true));
+		expect(LogLevelTst::from_string<StringCase::Insensitive>("wArNiNg") == LogLevelTst::Warning, equal_to(true));
+		expect(LogLevelTst::from_string<StringCase::Insensitive>(std::string{"averylongenumeratornametocheckblockcomparisons"})
+			== LogLevelTst::AVeryLongEnumeratorNameToCheckBlockComparisons, equal_to(true));
+	});
+
+	_.test("Case folding only applies to ASCII letters", []() {
+		expect(Details::equalIgnoreCase("Error@[", "ERROR`{"), equal_to(false));
+		expect(Details::equalIgnoreCase("\xC9rror", "\xE9rror"), equal_to(false));
+		expect(Details::hashIgnoreCase("InFo_42"), equal_to(Details::hashIgnoreCase("iNfO_42")));
+	});
+
+	_.test("Lookup at compile time", []() {
+		static_assert(LogLevelTst::from_string("Info") == LogLevelTst::Info, "");
+		static_assert(LogLevelTst::from_string<EnumUtils::StringCase::Insensitive>("INFO") == LogLevelTst::Info, "");
+	});
+
+	_.test("Lookup without failure", []() {
+		expect(LogLevelTst::try_from_string("Warning") == LogLevelTst::Warning, equal_to(true));
+		expect(LogLevelTst::try_from_string("Warn").has_value(), equal_to(false));
+		expect(LogLevelTst::try_from_string<EnumUtils::StringCase::Insensitive>("warning") == LogLevelTst::Warning, equal_to(true));
+
+		expect(ConnectionStateTst::try_from_value(2) == ConnectionStateTst::Connected, equal_to(true));
+		expect(ConnectionStateTst::try_from_value(42).has_value(), equal_to(false));
+		expect(IterableEnumTst1::try_from_value(4) == IterableEnumTst1::Test5, equal_to(true));
+		expect(IterableEnumTst1::try_from_value(5).has_value(), equal_to(false));
+		static_assert(!ConnectionStateTst::try_from_value(6), "");
+	});
+});
+
+suite<> enumHashSuite("Testing suite for enum and name hashing", [](auto& _){
+	_.test("Enumerators as unordered container keys", []() {
+		std::unordered_set<LogLevelTst> levels{LogLevelTst::Error, LogLevelTst::Warning, LogLevelTst::Error};
+
+		expect(levels.size(), equal_to(2));
+		expect(levels.count(LogLevelTst::Warning), equal_to(1));
+		expect(levels.count(LogLevelTst::Info), equal_to(0));
+	});
+
+	_.test("Name hashes match the runtime string hash", []() {
+		for(size_t i = 0; i < LogLevelTst::size(); ++i)
+		{
+			std::string name{LogLevelTst::names()[i]};
+			expect(LogLevelTst::name_hashes()[i], equal_to(Details::hashBytes(name.data(), name.size())));
+		}
+		static_assert(ConnectionStateTst::name_hashes()[0] == Details::hashBytes("Idle", 4), "");
+	});
+
+	_.test("Names as heterogeneous keys", []() {
+		std::unordered_map<std::string, LogLevelTst, StringHash, StringEqual> byName;
+		for(auto level : LogLevelTst::iter())
+		{
+			byName.emplace(std::string{level.to_string()}, level);
+		}
+
+		expect(byName.find(ConstString{"Warning"})->second == LogLevelTst::Warning, equal_to(true));
+		expect(byName.find(ConstString{"warning"}) == byName.end(), equal_to(true));
+	});
+});
+
+suite<> decoratedNamesSuite("Testing suite for qualified and debug enum names", [](auto& _){
+	_.test("Qualified names", []() {
+		expect(std::string{LogLevelTst{LogLevelTst::Warning}.to_qualified_string()}, equal_to("LogLevelTst::Warning"));
+		expect(std::string{ImprovedEnumTst3{ImprovedEnumTst3::Test4}.to_qualified_string()}, equal_to("ImprovedEnumTst3::Test4"));
+	});
+
+	_.test("Debug names", []() {
+		expect(std::string{LogLevelTst{LogLevelTst::Error}.to_debug_string()}, equal_to("Error(0)"));
+		expect(std::string{ImprovedEnumTst3{ImprovedEnumTst3::Test4}.to_debug_string()}, equal_to("Test4(27)"));
+		expect(std::string{ImprovedEnumTst3{ImprovedEnumTst3::Test5}.to_debug_string()}, equal_to("Test5(28)"));
+	});
+
+	_.test("Debug names of character enums", []() {
+		expect(std::string{CharTst{CharTst::B}.to_debug_string()}, equal_to("B(120)"));
+		expect(std::string{CharTst{CharTst::C}.to_debug_string()}, equal_to("C(121)"));
+		expect(std::string{WideCharTst{WideCharTst::B}.to_debug_string()}, equal_to("B(1)"));
+	});
+
+	_.test("Decorated names are null terminated", []() {
+		ConstString name = ImprovedEnumTst3{ImprovedEnumTst3::Test2}.to_debug_string();
+
+		expect(std::string{name.data()}, equal_to("Test2(9)"));
+	});
+
+	_.test("Values outside of the enumeration", []() {
+		for(LogLevelTst invalid : {LogLevelTst{static_cast<LogLevelTst::InternalLogLevelTst>(7)},
+								   LogLevelTst{static_cast<LogLevelTst::InternalLogLevelTst>(-1)}})
+		{
+			expect(invalid.get_index(), equal_to(LogLevelTst::size()));
+			expect(LogLevelTst::iter().from(invalid) == LogLevelTst::iter().end(), equal_to(true));
+			expect(std::string{invalid.to_qualified_string()}, equal_to(""));
+			expect(std::string{invalid.to_debug_string()}, equal_to(""));
+		}
+	});
+
+	_.test("Values far outside of a contiguous enumeration", []() {
+		static_assert(OffsetTst::is_contiguous(), "");
+		static_assert(OffsetTst{static_cast<OffsetTst::InternalOffsetTst>(INT64_MAX)}.get_index() == OffsetTst::size(), "");
+		static_assert(OffsetTst{OffsetTst::Above}.get_index() == 2, "");
+		for(int64_t value : {INT64_MAX, INT64_MIN, int64_t{-3}, int64_t{1}})
+		{
+			expect(OffsetTst{static_cast<OffsetTst::InternalOffsetTst>(value)}.get_index(), equal_to(OffsetTst::size()));
+		}
+	});
+
+	_.test("Decorated names at compile time", []() {
+		static_assert(ConnectionStateTst{ConnectionStateTst::Idle}.to_qualified_string() == ConstString{"ConnectionStateTst::Idle"}, "");
+		static_assert(ConnectionStateTst{ConnectionStateTst::Idle}.to_debug_string() == ConstString{"Idle(0)"}, "");
+	});
+});
+
+suite<> enumIteratorSuite("Testing suite for the enum iterators", [](auto& _){
+	_.test("Iterators are a single pointer", []() {
+		static_assert(sizeof(ImprovedEnumTst3::iterator) == sizeof(void*), "");
+		static_assert(sizeof(ImprovedEnumTst3::reverse_iterator) == sizeof(void*), "");
+		static_assert(std::random_access_iterator<ImprovedEnumTst3::reverse_iterator>, "");
+	});
+
+	_.test("Random access", []() {
+		auto range = ImprovedEnumTst3::iter();
+		auto it = range.begin() + 3;
+
+		expect(it->to_value(), equal_to(27));
+		expect(it[-1].to_value(), equal_to(12));
+		expect(range.end() - it, equal_to(2));
+		expect(it > range.begin(), equal_to(true));
+		expect(ImprovedEnumTst3::iter_from(ImprovedEnumTst3::Test4).begin() == it, equal_to(true));
+	});
+
+	_.test("Legacy algorithms", []() {
+		auto range = ImprovedEnumTst3::iter();
+
+		expect(std::prev(range.end())->to_value(), equal_to(28));
+		expect(std::distance(range.begin(), range.end()), equal_to(5));
+		expect(std::lower_bound(range.begin(), range.end(), ImprovedEnumTst3{ImprovedEnumTst3::Test3}) - range.begin(), equal_to(2));
+		// Forward iterators must give references to elements that outlive them.
+		static_assert(std::is_same<std::iterator_traits<ImprovedEnumTst3::iterator>::reference, const ImprovedEnumTst3&>::value, "");
+		expect(&*range.begin() == &*ImprovedEnumTst3::iter().begin(), equal_to(true));
+		// The iterators point in the array of enumerators, in the order of values().
+		expect(&*range.begin() == ImprovedEnumTst3::enumerators().data(), equal_to(true));
+		static_assert(ImprovedEnumTst3::enumerators()[3].to_value() == ImprovedEnumTst3::values()[3], "");
+	});
+
+	_.test("Reverse iteration", []() {
+		auto range = ImprovedEnumTst3::iter();
+		std::vector<size_t> values;
+		for(auto it = range.rbegin(); it != range.rend(); ++it)
+		{
+			values.push_back(it->to_value());
+		}
+
+		expect(values, equal_to(std::vector<size_t>{28, 27, 12, 9, 0}));
+		expect(range.rend() - range.rbegin(), equal_to(5));
+		expect((range.rbegin() + 1)->to_value(), equal_to(27));
+		expect(range.rbegin() < range.rend(), equal_to(true));
+	});
+});
+
+#endif // ENUM_UTILS_TEST_HXX
@@ -3,6 +3,7 @@
 #include <iterator>
 #include <list>
 #include <map>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -13,6 +14,9 @@ using namespace mettle;
 
 #include <Range.hxx>
 
+// Visible without including RangeViews.hxx.
+static_assert(std::ranges::borrowed_range<range<std::vector<int>::iterator>>, "");
+
 template<class Container,
 		 std::enable_if_t<
 		 	std::is_same<typename std::iterator_traits<typename Container::iterator>::iterator_category, std::bidirectional_iterator_tag>::value
@@ -391,4 +395,68 @@ suite<> rangeSuite("Range testing", [](auto& _){
 		expect(rnge1.end(), equal_to(rnge3.end()));
 		expect(rnge1.size(), equal_to(rnge3.size()));
 	});
-});
\ No newline at end of file
+	
+	_.test("Null terminated range", [](){
+		const char* str = "Hello";
+		auto rnge = null_terminated(str);
+		
+		static_assert(sizeof(rnge) == sizeof(const char*), "");
+		expect(rnge.empty(), equal_to(false));
+		expect(rnge.size(), equal_to(5));
+		expect(rnge.front(), equal_to('H'));
+		expect(std::string(rnge.begin(), std::next(rnge.begin(), 5)), equal_to("Hello"));
+		
+		size_t count = 0;
+		for(char c : rnge)
+		{
+			count += c == 'l';
+		}
+		expect(count, equal_to(2));
+		
+		rnge.pop_front();
+		expect(rnge.front(), equal_to('e'));
+		expect(null_terminated("").empty(), equal_to(true));
+		static_assert(null_terminated("abc").size() == 3, "");
+	});
+	
+	_.test("Range ended by the default sentinel", [](){
+		std::istringstream stream{"Some text"};
+		range rnge{std::istreambuf_iterator<char>{stream}, std::default_sentinel};
+		
+		std::string text;
+		for(char c : rnge)
+		{
+			text += c;
+		}
+		expect(text, equal_to("Some text"));
+	});
+	
+	_.test("Size of a range after popping", [](){
+		std::list<int> list{1, 2, 3, 4};
+		range<std::list<int>::iterator> rnge{list.begin(), list.end()};
+		
+		expect(rnge.size(), equal_to(4));
+		rnge.pop_front();
+		rnge.pop_back();
+		expect(rnge.size(), equal_to(2));
+		expect(rnge.front(), equal_to(2));
+		expect(rnge.back(), equal_to(3));
+		rnge.pop_back();
+		rnge.pop_back();
+		expect(rnge.empty(), equal_to(true));
+		expect(rnge.size(), equal_to(0));
+	});
+	
+	_.test("Size of a range after moving its ends", [](){
+		std::list<int> list{1, 2, 3, 4, 5};
+		range<std::list<int>::iterator> rnge{list.begin(), list.end()};
+		
+		expect(rnge.size(), equal_to(5));
+		++rnge.first;
+		++rnge.first;
+		expect(rnge.size(), equal_to(3));
+		--rnge.last;
+		expect(rnge.size(), equal_to(2));
+		expect(rnge.front(), equal_to(3));
+	});
+});
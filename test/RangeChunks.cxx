@@ -0,0 +1,167 @@
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ByteSet.hxx>
+#include <RangeChunks.hxx>
+#include <StaticString.hxx>
+
+namespace
+{
+
+// Sum of the elements, a block at a time then the remainder, like a batch kernel.
+constexpr int blockSum(const std::array<int, 10>& values)
+{
+	const auto blocks = values | views::chunks<4>();
+	int sum = 0;
+	for(std::span<const int, 4> block : blocks)
+	{
+		sum += block[0] + block[1] + block[2] + block[3];
+	}
+	for(int value : blocks.remainder())
+	{
+		sum += value;
+	}
+	return sum;
+}
+
+constexpr std::array<int, 10> numbers{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+static_assert(blockSum(numbers) == 55, "");
+static_assert((numbers | views::chunks<4>()).size() == 2, "");
+static_assert((numbers | views::aligned_chunks<4>()).prologue().empty(), "");
+static_assert((numbers | views::partitions(3))[2].size() == 10, "");
+
+}
+
+suite<> rangeChunksSuite("Testing suite for the range chunks", [](auto& _){
+	_.test("Chunks", []() {
+		std::vector<int> values(11);
+		std::iota(values.begin(), values.end(), 0);
+		const auto blocks = values | views::chunks<4>();
+		expect(blocks.size(), equal_to(2));
+		expect(blocks.prologue().size(), equal_to(0));
+
+		std::vector<int> firsts;
+		for(std::span<int, 4> block : blocks)
+		{
+			firsts.push_back(block.front());
+		}
+		expect(firsts, equal_to(std::vector<int>{0, 4}));
+		expect(blocks.remainder().size(), equal_to(3));
+		expect(blocks.remainder().front(), equal_to(8));
+
+		const auto none = values | views::chunks<16>();
+		expect(none.empty(), equal_to(true));
+		expect(none.begin() == none.end(), equal_to(true));
+		expect(none.remainder().size(), equal_to(11));
+
+		std::vector<int> empty;
+		expect((empty | views::chunks<4>()).remainder().empty(), equal_to(true));
+	});
+
+	_.test("Aligned chunks", []() {
+		alignas(64) std::array<uint32_t, 40> values{};
+		for(size_t offset = 0; offset < 8; ++offset)
+		{
+			const auto blocks = range<uint32_t*>{values.data() + offset, values.data() + values.size()} | views::aligned_chunks<4>();
+			expect(blocks.prologue().size(), equal_to((4 - offset % 4) % 4));
+			size_t covered = blocks.prologue().size() + blocks.remainder().size();
+			for(std::span<uint32_t, 4> block : blocks)
+			{
+				expect(reinterpret_cast<uintptr_t>(block.data()) % 16, equal_to(0));
+				covered += block.size();
+			}
+			expect(blocks.remainder().size() < 4, equal_to(true));
+			expect(covered, equal_to(values.size() - offset));
+		}
+
+		// Smaller than a block, all the elements are in the prologue.
+		const auto small = range<uint32_t*>{values.data() + 1, values.data() + 3} | views::aligned_chunks<4>();
+		expect(small.prologue().size(), equal_to(2));
+		expect(small.empty(), equal_to(true));
+		expect(small.remainder().empty(), equal_to(true));
+	});
+
+	_.test("Partitions", []() {
+		alignas(64) std::array<char, 1000> bytes{};
+		const auto parts = range<char*>{bytes.data() + 3, bytes.data() + bytes.size()} | views::partitions(4);
+		expect(parts.size(), equal_to(4));
+
+		char* expected = bytes.data() + 3;
+		for(std::span<char> part : parts)
+		{
+			expect(part.data() == expected, equal_to(true));
+			expected = part.data() + part.size();
+		}
+		expect(expected == bytes.data() + bytes.size(), equal_to(true));
+
+		for(size_t i = 1; i < parts.size(); ++i)
+		{
+			expect(reinterpret_cast<uintptr_t>(parts[i].data()) % 64, equal_to(0));
+			// Shared evenly, to a cache line.
+			expect(parts[i - 1].size() < 5 * 64, equal_to(true));
+		}
+
+		// More threads than lines : the extra parts are empty.
+		const auto few = range<char*>{bytes.data(), bytes.data() + 100} | views::partitions(8);
+		size_t total = 0;
+		for(std::span<char> part : few)
+		{
+			total += part.size();
+		}
+		expect(total, equal_to(100));
+	});
+
+	_.test("Partitions of elements not dividing a cache line", []() {
+		struct Small { uint32_t values[3]; };
+		struct Large { uint64_t values[3]; };
+		const auto check = []<class T>(std::vector<T>& elements) {
+			for(size_t offset = 0; offset < 20; ++offset)
+			{
+				const auto parts = range<T*>{elements.data() + offset, elements.data() + elements.size()} | views::partitions(4);
+				T* expected = elements.data() + offset;
+				for(std::span<T> part : parts)
+				{
+					expect(part.data() == expected, equal_to(true));
+					expected = part.data() + part.size();
+				}
+				expect(expected == elements.data() + elements.size(), equal_to(true));
+
+				for(size_t i = 1; i < parts.size(); ++i)
+				{
+					expect(parts[i].empty(), equal_to(false));
+					expect(reinterpret_cast<uintptr_t>(parts[i].data()) % 64, equal_to(0));
+				}
+			}
+		};
+
+		std::vector<Small> small(1000);
+		check(small);
+		std::vector<Large> large(1000);
+		check(large);
+	});
+
+	_.test("Blocked string kernels", []() {
+		StaticString<200> text;
+		text.resize(200);
+		for(size_t size : {0, 15, 16, 17, 31, 32, 33, 100, 200})
+		{
+			for(size_t position = 0; position <= size; ++position)
+			{
+				for(char& c : text)
+				{
+					c = 'a';
+				}
+				if(position < size)
+				{
+					text[position] = ',';
+				}
+				expect(Details::ByteSet{ConstString{",;"}}.findFirstOf(text.data(), size), equal_to(position));
+			}
+		}
+	});
+});
@@ -0,0 +1,110 @@
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ImprovedEnum.hxx>
+#include <RangeViews.hxx>
+
+IMPROVED_ENUM(ViewStateTst, uint8_t,
+	Idle,
+	Running,
+	Failed = 10,
+	TimedOut,
+	Done = 20
+);
+
+namespace
+{
+
+constexpr bool isError(ViewStateTst state)
+{
+	return state == ViewStateTst::Failed || state == ViewStateTst::TimedOut;
+}
+
+constexpr auto errorStates()
+{
+	return ViewStateTst::iter() | views::filter(isError);
+}
+
+// Derived table computed at compile time, instead of at startup.
+constexpr auto errorTable = views::to_array<views::count(errorStates())>(errorStates());
+static_assert(errorTable.size() == 2, "");
+static_assert(errorTable[1] == ViewStateTst::TimedOut, "");
+
+constexpr std::array<const char*, ViewStateTst::size()> descriptions{{"idle", "running", "failed", "timed out", "done"}};
+
+}
+
+suite<> rangeViewsSuite("Testing suite for the range views", [](auto& _){
+	_.test("Filter and transform", []() {
+		std::vector<int> values;
+		for(int value : ViewStateTst::iter() | views::filter(isError) | views::transform([](ViewStateTst state) { return state.to_value() * 2; }))
+		{
+			values.push_back(value);
+		}
+		expect(values, equal_to(std::vector<int>{20, 22}));
+	});
+
+	_.test("Take and drop", []() {
+		std::vector<ViewStateTst> states;
+		for(ViewStateTst state : ViewStateTst::iter() | views::drop(1) | views::take(2))
+		{
+			states.push_back(state);
+		}
+		expect(states.size(), equal_to(2));
+		expect(states[0] == ViewStateTst::Running, equal_to(true));
+		expect(states[1] == ViewStateTst::Failed, equal_to(true));
+
+		expect(views::count(ViewStateTst::iter() | views::take(10)), equal_to(5));
+		expect(views::count(ViewStateTst::iter() | views::drop(10)), equal_to(0));
+	});
+
+	_.test("Enumerate and zip", []() {
+		std::string text;
+		for(auto [index, state] : ViewStateTst::iter() | views::filter(isError) | views::enumerate())
+		{
+			text += std::to_string(index) + ":" + std::string{state.to_string()} + " ";
+		}
+		expect(text, equal_to("0:Failed 1:TimedOut "));
+
+		std::vector<std::string> described;
+		for(auto [state, description] : errorStates() | views::zip(descriptions))
+		{
+			described.push_back(description);
+		}
+		// Zipped after filtering, so with the first descriptions.
+		expect(described, equal_to(std::vector<std::string>{"idle", "running"}));
+
+		std::vector<std::string> aligned;
+		for(auto [state, description] : ViewStateTst::iter() | views::zip(descriptions) | views::filter([](auto pair) { return isError(pair.first); }))
+		{
+			aligned.push_back(description);
+		}
+		expect(aligned, equal_to(std::vector<std::string>{"failed", "timed out"}));
+	});
+
+	_.test("Adaptors over other ranges", []() {
+		std::list<int> list{1, 2, 3, 4, 5, 6};
+		auto evens = list | views::filter([](int i) { return i % 2 == 0; });
+		expect(views::count(evens), equal_to(3));
+		expect(*evens.begin(), equal_to(2));
+
+		int sum = 0;
+		for(int value : null_terminated("abc") | views::transform([](char c) { return c - 'a'; }))
+		{
+			sum += value;
+		}
+		expect(sum, equal_to(3));
+	});
+
+	_.test("Constant evaluation", []() {
+		static_assert(views::count(ViewStateTst::iter() | views::filter(isError)) == 2, "");
+		constexpr auto values = views::to_array<3>(ViewStateTst::iter() | views::take(3) | views::transform([](ViewStateTst state) { return state.to_value(); }));
+		static_assert(values[2] == 10, "");
+		expect(errorTable[0] == ViewStateTst::Failed, equal_to(true));
+	});
+});
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <StaticRing.hxx>
+
+namespace
+{
+
+static_assert(std::is_trivially_copyable<StaticRing<int, 4>>::value, "");
+static_assert(std::random_access_iterator<StaticRing<int, 4>::iterator>, "");
+
+template<class Ring>
+std::vector<int> elements(const Ring& ring)
+{
+	return {ring.begin(), ring.end()};
+}
+
+constexpr int lastSum()
+{
+	StaticRing<int, 3> ring;
+	for(int i = 1; i <= 5; ++i)
+	{
+		ring.push_back<RingOverflowPolicy::Overwrite>(i);
+	}
+	return ring[0] + ring[1] + ring[2];
+}
+
+static_assert(lastSum() == 3 + 4 + 5, "");
+
+}
+
+suite<> staticRingSuite("Testing suite for StaticRing", [](auto& _){
+	_.test("Push and pop at both ends", []() {
+		StaticRing<int, 4> ring;
+		ring.push_back(2);
+		ring.push_back(3);
+		ring.push_front(1);
+		expect(elements(ring), equal_to(std::vector<int>{1, 2, 3}));
+		expect(ring.front(), equal_to(1));
+		expect(ring.back(), equal_to(3));
+
+		ring.pop_front();
+		ring.push_back(4);
+		ring.push_back(5);
+		expect(ring.full(), equal_to(true));
+		expect(elements(ring), equal_to(std::vector<int>{2, 3, 4, 5}));
+
+		ring.pop_back();
+		expect(elements(ring), equal_to(std::vector<int>{2, 3, 4}));
+		ring.clear();
+		expect(ring.empty(), equal_to(true));
+	});
+
+	_.test("Overwrite", []() {
+		StaticRing<int, 3> ring;
+		for(int i = 0; i < 7; ++i)
+		{
+			ring.push_back<RingOverflowPolicy::Overwrite>(i);
+		}
+		expect(elements(ring), equal_to(std::vector<int>{4, 5, 6}));
+
+		ring.push_front<RingOverflowPolicy::Overwrite>(3);
+		expect(elements(ring), equal_to(std::vector<int>{3, 4, 5}));
+	});
+
+	_.test("Iterators", []() {
+		StaticRing<int, 4> ring;
+		for(int i : {7, 1, 9, 4, 2})
+		{
+			ring.push_back<RingOverflowPolicy::Overwrite>(i);
+		}
+		std::sort(ring.begin(), ring.end());
+		expect(elements(ring), equal_to(std::vector<int>{1, 2, 4, 9}));
+		expect(*ring.rbegin(), equal_to(9));
+		expect(ring.end() - ring.begin(), equal_to(4));
+
+		StaticRing<std::string, 2> names;
+		names.push_back("a");
+		names.push_back("b");
+		names.push_back<RingOverflowPolicy::Overwrite>("c");
+		expect(names.front(), equal_to("b"));
+	});
+});
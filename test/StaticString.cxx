@@ -0,0 +1,138 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <StaticString.hxx>
+
+namespace
+{
+
+template<size_t Tsize>
+std::string str(const StaticString<Tsize>& s)
+{
+	return {s.data(), s.size()};
+}
+
+constexpr StaticString<32> buildAtCompileTime()
+{
+	StaticString<32> s;
+	s.append("id=").append(-42).append(',').append(18446744073709551615ull);
+	return s;
+}
+
+}
+
+suite<> staticStringBuilderSuite("Testing suite for StaticString building", [](auto& _){
+	_.test("Append strings and characters", []() {
+		StaticString<16> s;
+		s.append("Hello").append(' ').append(ConstString{"world"});
+		s.push_back('!');
+
+		expect(str(s), equal_to("Hello world!"));
+		expect(s.size(), equal_to(12));
+		expect(std::strlen(s.data()), equal_to(12));
+	});
+
+	_.test("Append integers", []() {
+		StaticString<64> s;
+		s.append(0).append(' ').append(-7).append(' ').append(uint8_t{255}).append(' ')
+		 .append(std::numeric_limits<int64_t>::min()).append(' ').append(std::numeric_limits<uint64_t>::max());
+
+		expect(str(s), equal_to("0 -7 255 -9223372036854775808 18446744073709551615"));
+	});
+
+	_.test("Append floating point values", []() {
+		StaticString<64> s;
+		s.append(0.5).append(' ').append(3.14159, 2).append(' ').append(-1.0f).append(' ').append(1e300, 1);
+
+		expect(str(s), equal_to("0.5 3.14 -1 1.0e+300"));
+	});
+
+	_.test("Truncation policy", []() {
+		StaticString<8> s;
+		s.append<TruncationPolicy::Truncate>("Hello world");
+
+		expect(str(s), equal_to("Hello wo"));
+		expect(s.size(), equal_to(s.capacity()));
+
+		s.append<TruncationPolicy::Truncate>('x').append<TruncationPolicy::Truncate>(123);
+		expect(str(s), equal_to("Hello wo"));
+
+		s.clear();
+		s.append<TruncationPolicy::Truncate>(1234567890);
+		expect(str(s), equal_to("12345678"));
+	});
+
+	_.test("Clear and empty", []() {
+		StaticString<8> s{"Foo"};
+		expect(s.empty(), equal_to(false));
+
+		s.clear();
+		expect(s.empty(), equal_to(true));
+		expect(str(s.append("Bar")), equal_to("Bar"));
+	});
+
+	_.test("Building at compile time", []() {
+		constexpr StaticString<32> s = buildAtCompileTime();
+
+		static_assert(s.size() == 27, "");
+		static_assert(s == ConstString{"id=-42,18446744073709551615"}, "");
+		expect(str(s), equal_to("id=-42,18446744073709551615"));
+	});
+
+	_.test("Concatenation", []() {
+		constexpr StaticString<3> foo{"Foo"};
+		constexpr StaticString<3> bar{"Bar"};
+		constexpr auto joined = foo + "::" + bar + '!';
+
+		static_assert(joined.capacity() == 9, "");
+		static_assert(joined == ConstString{"Foo::Bar!"}, "");
+		expect(str('[' + foo + ']'), equal_to("[Foo]"));
+		expect(str("<" + bar), equal_to("<Bar"));
+	});
+
+	_.test("Integer conversion", []() {
+		static_assert(toStaticString(-1234) == ConstString{"-1234"}, "");
+		static_assert(toStaticString(uint8_t{200}) == ConstString{"200"}, "");
+		expect(str(toStaticString(0)), equal_to("0"));
+	});
+
+	_.test("Construction from ranges", []() {
+		constexpr ConstString text{"Hello"};
+		constexpr StaticString<8> forward{text.begin(), text.end()};
+		static_assert(forward == ConstString{"Hello"}, "");
+
+		const char* chars = "Hello world";
+		StaticString<16> fromPointers{chars + 6, chars + 11};
+		expect(str(fromPointers), equal_to("world"));
+		expect(str(StaticString<4>{chars, chars}), equal_to(""));
+
+		const char* cstr = chars;
+		StaticString<16> fromCString{null_terminated(cstr)};
+		expect(str(fromCString), equal_to("Hello world"));
+		static_assert(StaticString<8>{null_terminated("Hello")} == ConstString{"Hello"}, "");
+	});
+
+	_.test("Compact layout", []() {
+		static_assert(sizeof(StaticString<15>) == 16, "");
+		static_assert(sizeof(StaticString<255>) == 256, "");
+		static_assert(sizeof(std::array<StaticString<23>, 4>) == 4 * 24, "");
+		// Past 255 characters, or without the compact layout, the size is kept apart in the smallest type possible.
+		static_assert(sizeof(StaticString<256>) == 260, "");
+		static_assert(sizeof(Details::StaticStringStorage<15, false>) == 17, "");
+
+		StaticString<4> s{"Fo"};
+		expect(s.size(), equal_to(2));
+		s.append("ur");
+		expect(s.size(), equal_to(4));
+		expect(s.data()[4], equal_to('\0'));
+		s.resize(1);
+		expect(str(s), equal_to("F"));
+		expect(std::strlen(s.data()), equal_to(1));
+	});
+});
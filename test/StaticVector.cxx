@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <type_traits>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ImprovedEnum.hxx>
+#include <StaticVector.hxx>
+
+IMPROVED_ENUM(VectorColorTst, uint8_t,
+	Red,
+	Green,
+	Blue
+);
+
+namespace
+{
+
+using Colors = StaticVector<VectorColorTst, 8>;
+
+static_assert(std::is_trivially_copyable<Colors>::value, "");
+static_assert(sizeof(StaticVector<uint8_t, 15>) == 16, "");
+static_assert(std::ranges::contiguous_range<StaticVector<int, 4>> || ARRAY_ITERATOR_CHECKED, "");
+static_assert(std::ranges::random_access_range<Colors>, "");
+
+constexpr Colors primaries()
+{
+	Colors colors;
+	for(VectorColorTst color : VectorColorTst::iter())
+	{
+		colors.push_back(color);
+	}
+	colors.erase(colors.begin() + 1);
+	return colors;
+}
+
+static_assert(primaries().size() == 2, "");
+static_assert(primaries()[1] == VectorColorTst::Blue, "");
+
+}
+
+suite<> staticVectorSuite("Testing suite for StaticVector", [](auto& _){
+	_.test("Push and pop", []() {
+		StaticVector<int, 4> values{1, 2};
+		values.push_back(3);
+		expect(values.emplace_back(4), equal_to(4));
+		expect(values.full(), equal_to(true));
+		expect(values.front(), equal_to(1));
+		expect(values.back(), equal_to(4));
+
+		values.pop_back();
+		expect(values.size(), equal_to(3));
+		expect(values.back(), equal_to(3));
+
+		values.resize(1);
+		expect(values.size(), equal_to(1));
+		values.clear();
+		expect(values.empty(), equal_to(true));
+	});
+
+	_.test("Growing value initializes", []() {
+		StaticVector<int, 4> values;
+		values.push_back(42);
+		values.pop_back();
+		values.resize(2);
+		expect(values[0], equal_to(0));
+		expect(values[1], equal_to(0));
+	});
+
+	_.test("Iterators", []() {
+		StaticVector<int, 8> values{5, 3, 8, 1};
+		std::sort(values.begin(), values.end());
+		expect(values == StaticVector<int, 4>{1, 3, 5, 8}, equal_to(true));
+
+		std::string text;
+		for(auto it = values.crbegin(); it != values.crend(); ++it)
+		{
+			text += std::to_string(*it);
+		}
+		expect(text, equal_to("8531"));
+
+		auto it = values.erase(values.begin());
+		expect(*it, equal_to(3));
+		expect(values.size(), equal_to(3));
+	});
+
+	_.test("Elements owning resources", []() {
+		StaticVector<std::string, 3> names{"first", "second"};
+		names.push_back(std::string(100, 'x'));
+		names.pop_back();
+		expect(names.size(), equal_to(2));
+		names.resize(3);
+		expect(names[2].empty(), equal_to(true));
+
+		StaticVector<std::string, 3> copy{names};
+		expect(copy == names, equal_to(true));
+	});
+
+	_.test("From ranges", []() {
+		const StaticVector<VectorColorTst, 3> colors{range<VectorColorTst::iterator>{VectorColorTst::iter().begin(), VectorColorTst::iter().end()}};
+		expect(colors.size(), equal_to(3));
+		expect(colors[2] == VectorColorTst::Blue, equal_to(true));
+	});
+});
@@ -0,0 +1,146 @@
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ImprovedEnum.hxx>
+#include <StringPool.hxx>
+
+IMPROVED_ENUM(PoolColorTst, uint8_t,
+	Red,
+	Green,
+	Blue
+);
+
+IMPROVED_ENUM(PoolLightTst, uint8_t,
+	Red,
+	Amber,
+	Green
+);
+
+suite<> stringPoolSuite("Testing suite for StringPool", [](auto& _){
+	_.test("Interning gives a canonical string", []() {
+		StringPool pool;
+		const std::string foo = "Foo";
+
+		InternedString first = pool.intern(foo);
+		InternedString second = pool.intern("Foo");
+		InternedString other = pool.intern("Bar");
+
+		expect(first == second, equal_to(true));
+		expect(first.data() == second.data(), equal_to(true));
+		expect(first != other, equal_to(true));
+		expect(first.data() != foo.data(), equal_to(true));
+		expect(first.str() == ConstString{"Foo"}, equal_to(true));
+		expect(first.data()[3], equal_to('\0'));
+		expect(pool.size(), equal_to(2));
+	});
+
+	_.test("Find does not intern", []() {
+		StringPool pool;
+		expect(pool.find("Foo").valid(), equal_to(false));
+		InternedString foo = pool.intern("Foo");
+		expect(pool.find("Foo") == foo, equal_to(true));
+		expect(pool.size(), equal_to(1));
+		expect(InternedString{}.str() == ConstString{""}, equal_to(true));
+	});
+
+	_.test("Enum names are registered without copy", []() {
+		StringPool pool;
+		pool.registerEnum<PoolColorTst>();
+
+		InternedString green = pool.intern(std::string{"Green"});
+		expect(green.data() == PoolColorTst{PoolColorTst::Green}.to_string().data(), equal_to(true));
+		expect(green.hash() == PoolColorTst::name_hashes()[1], equal_to(true));
+		expect(pool.size(), equal_to(3));
+
+		pool.registerEnum<PoolColorTst>();
+		expect(pool.size(), equal_to(3));
+	});
+
+	_.test("Names interned before registerEnum keep their copy", []() {
+		StringPool pool;
+		InternedString red = pool.intern(std::string{"Red"});
+		pool.registerEnum<PoolColorTst>();
+
+		expect(pool.intern("Red") == red, equal_to(true));
+		expect(red.data() != PoolColorTst{PoolColorTst::Red}.to_string().data(), equal_to(true));
+		expect(pool.intern("Blue").data() == PoolColorTst{PoolColorTst::Blue}.to_string().data(), equal_to(true));
+		expect(pool.size(), equal_to(3));
+	});
+
+	_.test("Enum names seed a pool", []() {
+		StringPool pool{EnumNamesSeed<PoolColorTst, PoolLightTst>{}};
+		expect(pool.size(), equal_to(4));
+
+		InternedString red = pool.intern(std::string{"Red"});
+		expect(red.data() == PoolColorTst{PoolColorTst::Red}.to_string().data(), equal_to(true));
+		expect(pool.find("Amber").data() == PoolLightTst{PoolLightTst::Amber}.to_string().data(), equal_to(true));
+		// Names shared by two enums are the ones of the first.
+		expect(pool.find("Green").data() == PoolColorTst{PoolColorTst::Green}.to_string().data(), equal_to(true));
+	});
+
+	_.test("Growth keeps the enum names", []() {
+		StringPool pool{EnumNamesSeed<PoolColorTst>{}};
+		for(size_t i = 0; i < 1000; ++i)
+		{
+			pool.intern(std::to_string(i));
+		}
+		expect(pool.find("Green").data() == PoolColorTst{PoolColorTst::Green}.to_string().data(), equal_to(true));
+		expect(pool.size(), equal_to(1003));
+	});
+
+	_.test("Growth keeps every string", []() {
+		StringPool pool;
+		std::vector<InternedString> interned;
+		for(size_t i = 0; i < 5000; ++i)
+		{
+			// Some long enough to get their own arena chunk.
+			interned.push_back(pool.intern(std::to_string(i) + std::string(i % 1500, 'x')));
+		}
+		expect(pool.size(), equal_to(5000));
+		for(size_t i = 0; i < 5000; ++i)
+		{
+			expect(pool.find(std::to_string(i) + std::string(i % 1500, 'x')) == interned[i], equal_to(true));
+		}
+		std::unordered_set<InternedString> unique(interned.begin(), interned.end());
+		expect(unique.size(), equal_to(5000));
+	});
+
+	_.test("Concurrent interning", []() {
+		StringPool pool;
+		constexpr size_t threadCount = 4;
+		constexpr size_t stringCount = 2000;
+		std::vector<std::vector<InternedString>> results(threadCount);
+		std::vector<std::thread> threads;
+		for(size_t t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([&pool, &results, t]() {
+				for(size_t i = 0; i < stringCount; ++i)
+				{
+					// Every thread interns the same strings, in a different order.
+					results[t].push_back(pool.intern("name" + std::to_string((i * (2 * t + 1)) % stringCount)));
+				}
+			});
+		}
+		for(auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		expect(pool.size(), equal_to(stringCount));
+		for(size_t t = 0; t < threadCount; ++t)
+		{
+			for(size_t i = 0; i < stringCount; ++i)
+			{
+				if(results[t][i] != pool.find("name" + std::to_string((i * (2 * t + 1)) % stringCount)))
+				{
+					expect(false, equal_to(true));
+				}
+			}
+		}
+	});
+});
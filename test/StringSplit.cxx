@@ -0,0 +1,123 @@
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <mettle/header_only.hpp>
+using namespace mettle;
+
+#include <ImprovedEnum.hxx>
+#include <StringSplit.hxx>
+
+IMPROVED_ENUM(SplitLevelTst, uint8_t,
+	Debug,
+	Info,
+	Warning,
+	Error
+);
+
+namespace
+{
+
+static_assert(std::forward_iterator<SplitIterator>, "");
+static_assert(std::is_same<std::iter_reference_t<SplitIterator>, ConstString>::value, "");
+
+std::vector<std::string> collect(SplitView view)
+{
+	std::vector<std::string> fields;
+	for(ConstString field : view)
+	{
+		fields.emplace_back(field.data(), field.size());
+	}
+	return fields;
+}
+
+constexpr size_t countFields(ConstString str, ConstString delimiters)
+{
+	size_t count = 0;
+	for(auto it = tokenize(str, delimiters).begin(); it != SplitIterator{}; ++it)
+	{
+		++count;
+	}
+	return count;
+}
+
+}
+
+suite<> stringSplitSuite("Testing suite for the ConstString splitter", [](auto& _){
+	_.test("Split on a single delimiter", []() {
+		expect(collect(split("a,bc,def", ",")), equal_to(std::vector<std::string>{"a", "bc", "def"}));
+	});
+
+	_.test("Split keeps empty fields", []() {
+		expect(collect(split(",a,,b,", ",")), equal_to(std::vector<std::string>{"", "a", "", "b", ""}));
+		expect(collect(split("", ",")), equal_to(std::vector<std::string>{""}));
+		expect(collect(split("abc", ",")), equal_to(std::vector<std::string>{"abc"}));
+	});
+
+	_.test("Tokenize skips empty fields", []() {
+		expect(collect(tokenize("  a \t b\n\nc  ", " \t\n")), equal_to(std::vector<std::string>{"a", "b", "c"}));
+		expect(collect(tokenize("", " ")).empty(), equal_to(true));
+		expect(collect(tokenize("    ", " ")).empty(), equal_to(true));
+	});
+
+	_.test("Fields outlive their iterator", []() {
+		SplitView view = split("a,bc,def", ",");
+		auto it = view.begin();
+		auto copy = it;
+		ConstString first = *it;
+		++it;
+		ConstString second = *it;
+
+		expect(std::string(first.data(), first.size()), equal_to("a"));
+		expect(std::string(second.data(), second.size()), equal_to("bc"));
+		expect(*copy == ConstString{"a"}, equal_to(true));
+		expect(std::next(copy) == it, equal_to(true));
+	});
+
+	_.test("Slices point into the original string", []() {
+		ConstString line = "key=value";
+		auto it = split(line, "=").begin();
+
+		expect(it->data() == line.data(), equal_to(true));
+		++it;
+		expect(it->data() == line.data() + 4, equal_to(true));
+		expect(it.remainder().size(), equal_to(0));
+	});
+
+	_.test("Long strings and non ASCII delimiters", []() {
+		// Long enough to go through the vectorized search, with bytes sharing nibbles with the delimiters.
+		std::string text;
+		std::vector<std::string> expected;
+		for(size_t i = 0; i < 40; ++i)
+		{
+			std::string field(i % 37, static_cast<char>('A' + i % 26));
+			field += "\x2C\xA7\x17";
+			text += field;
+			text += (i % 2 == 0 ? '\xAC' : '|');
+			expected.push_back(field);
+		}
+		expected.push_back("");
+
+		expect(collect(split(text, "\xAC|")), equal_to(expected));
+	});
+
+	_.test("Fields feed enum lookups", []() {
+		std::vector<SplitLevelTst> levels;
+		for(ConstString field : tokenize("Info, Error,Debug", ", "))
+		{
+			levels.push_back(SplitLevelTst::from_string(field));
+		}
+
+		expect(levels.size(), equal_to(3));
+		expect(levels[0] == SplitLevelTst::Info, equal_to(true));
+		expect(levels[1] == SplitLevelTst::Error, equal_to(true));
+		expect(levels[2] == SplitLevelTst::Debug, equal_to(true));
+	});
+
+	_.test("Splitting at compile time", []() {
+		static_assert(countFields("a b  c", " ") == 3, "");
+		static_assert(split("Warning;Error", ";").front() == ConstString{"Warning"}, "");
+		static_assert(ConstString{"Warning"}.take(4) == ConstString{"Warn"}, "");
+	});
+});